@@ -40,6 +40,10 @@
  * Q: My application is crashing when I call sq_close. Why is this happening?<br>
  * A: All Sqrat::Object instances and derived type instances must be destroyed before calling sq_close.
  *
+ * Q: Can I use sq_setforeignptr on a VM that Sqrat is used with?<br>
+ * A: Yes, Sqrat keeps its own per-VM data in the registry table. Only if you define SCRAT_VM_DATA_IN_FOREIGN_PTR does Sqrat also
+ * cache that data in the foreign pointer to save a lookup per bound call, and the foreign pointer is then reserved for Sqrat.
+ *
  * \section discuss_sec Discussion and User Support
  *
  * Discussion about Sqrat happens at the Squirrel language forum, the Bindings section
@@ -65,5 +69,6 @@
 #include "sqrat/sqratUtil.h"
 #include "sqrat/sqratScript.h"
 #include "sqrat/sqratArray.h"
+#include "sqrat/sqratBinding.h"
 
 #endif
@@ -29,8 +29,11 @@
 #define _SCRAT_ALLOCATOR_H_
 
 #include <squirrel.h>
+#include <assert.h>
 #include <string.h>
 
+#include <new>
+
 #include "sqratObject.h"
 #include "sqratTypes.h"
 
@@ -57,6 +60,32 @@ public:
 };
 /// @endcond
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @cond DEV
+/// number of bytes an allocator wants Squirrel to reserve inside every instance (0 unless the allocator defines InstanceUserDataSize)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template< class A >
+class instance_user_data_size {
+    template<int x>
+    class receive_size{};
+
+    template< class U >
+    static int sfinae( receive_size< U::InstanceUserDataSize > * );
+
+    template< class U >
+    static char sfinae( ... );
+
+    template< class U, bool b >
+    struct get { enum { value = U::InstanceUserDataSize }; };
+
+    template< class U >
+    struct get< U, false > { enum { value = 0 }; };
+
+public:
+    enum { value = get< A, sizeof( sfinae<A>(0) ) == sizeof(int) >::value };
+};
+/// @endcond
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// DefaultAllocator is the allocator to use for Class that can both be constructed and copied
 ///
@@ -105,9 +134,11 @@ public:
     static void SetInstance(HSQUIRRELVM vm, SQInteger idx, C* ptr)
     {
         ClassData<C>* cd = ClassType<C>::getClassData(vm);
-        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >(ptr, cd->instances));
+        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >(ptr, cd->instances));
         sq_setreleasehook(vm, idx, &Delete);
-        sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,8 +399,10 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = reinterpret_cast<std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >*>(ptr);
-        instance->second->erase(instance->first);
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = reinterpret_cast<std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
         delete instance->first;
         delete instance;
         return 0;
@@ -400,9 +433,11 @@ public:
     static void SetInstance(HSQUIRRELVM vm, SQInteger idx, C* ptr)
     {
         ClassData<C>* cd = ClassType<C>::getClassData(vm);
-        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >(ptr, cd->instance));
+        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >(ptr, cd->instances));
         sq_setreleasehook(vm, idx, &Delete);
-        sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,8 +485,10 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = reinterpret_cast<std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >*>(ptr);
-        instance->second->erase(instance->first);
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = reinterpret_cast<std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
         delete instance->first;
         delete instance;
         return 0;
@@ -482,9 +519,11 @@ public:
     static void SetInstance(HSQUIRRELVM vm, SQInteger idx, C* ptr)
     {
         ClassData<C>* cd = ClassType<C>::getClassData(vm);
-        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >(ptr, cd->instances));
+        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >(ptr, cd->instances));
         sq_setreleasehook(vm, idx, &Delete);
-        sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,8 +569,10 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = reinterpret_cast<std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >*>(ptr);
-        instance->second->erase(instance->first);
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = reinterpret_cast<std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
         delete instance->first;
         delete instance;
         return 0;
@@ -587,9 +628,11 @@ public:
     static void SetInstance(HSQUIRRELVM vm, SQInteger idx, C* ptr)
     {
         ClassData<C>* cd = ClassType<C>::getClassData(vm);
-        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >(ptr, cd->instances));
+        sq_setinstanceup(vm, idx, new std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >(ptr, cd->instances));
         sq_setreleasehook(vm, idx, &Delete);
-        sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -850,14 +893,966 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = reinterpret_cast<std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >*>(ptr);
-        instance->second->erase(instance->first);
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = reinterpret_cast<std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
         delete instance->first;
         delete instance;
         return 0;
     }
 };
 
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// InlineAllocator is the allocator to use for Class that can both be constructed and copied and whose instances should
+/// live directly inside the memory of their Squirrel instance
+///
+/// \tparam C Type of class
+///
+/// \remarks
+/// Unlike DefaultAllocator, which heap allocates both the C object and the bookkeeping Sqrat needs for every instance,
+/// this allocator has Squirrel reserve room for both inside the instance (see sq_setclassudsize) and constructs C there
+/// with placement new. Creating and releasing an instance therefore does not allocate anything beyond the instance itself,
+/// which makes it the better choice for small value types (vectors, colors, rectangles) that scripts create in bulk.
+///
+/// \remarks
+/// Squirrel classes that extend a class using this allocator must call base.constructor in their constructor
+/// (the reserved memory is not initialized until they do, so the usual "unconstructed native class" error cannot be raised).
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<class C>
+class InlineAllocator {
+
+    typedef std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > > Header;
+
+    template <class T>
+    struct Alignment {
+        struct Probe { char c; T t; };
+        enum { value = sizeof(Probe) - sizeof(T) };
+    };
+
+    enum {
+        HeaderAlignment  = int(Alignment<Header>::value),
+        ValueAlignment   = int(Alignment<C>::value),
+        StorageAlignment = HeaderAlignment > ValueAlignment ? HeaderAlignment : ValueAlignment,
+        ValueOffset      = (sizeof(Header) + ValueAlignment - 1) / ValueAlignment * ValueAlignment
+    };
+
+    template <class T, bool b>
+    struct NewC
+    {
+        T* p;
+        NewC(void* storage)
+        {
+           p = new (storage) T();
+        }
+    };
+
+    template <class T>
+    struct NewC<T, false>
+    {
+        T* p;
+        NewC(void*)
+        {
+           p = 0;
+        }
+    };
+
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Number of bytes Sqrat has Squirrel reserve inside every instance of a Class using this allocator
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum { InstanceUserDataSize = ValueOffset + sizeof(C) + StorageAlignment - 1 };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the memory Squirrel reserved inside an instance, aligned for the bookkeeping Sqrat stores at its start
+    ///
+    /// \param vm  VM that has an instance object of the correct type at idx
+    /// \param idx Index of the stack that the instance object is at
+    ///
+    /// \return Start of the reserved memory
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void* GetStorage(HSQUIRRELVM vm, SQInteger idx) {
+        SQUserPointer up = NULL;
+        sq_getinstanceup(vm, idx, &up, 0);
+        assert(up != NULL); // fails if the class of the instance was not bound with this allocator
+        size_t misalignment = reinterpret_cast<size_t>(up) % StorageAlignment;
+        return static_cast<char*>(up) + (misalignment ? StorageAlignment - misalignment : 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the address inside the reserved memory at which C must be constructed
+    ///
+    /// \param storage Memory returned by GetStorage
+    ///
+    /// \return Address to use with placement new
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void* ValueStorage(void* storage) {
+        return static_cast<char*>(storage) + ValueOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Associates a newly created instance with an object that was constructed in its reserved memory
+    ///
+    /// \param vm      VM that has an instance object of the correct type at idx
+    /// \param idx     Index of the stack that the instance object is at
+    /// \param storage Memory reserved inside the instance (as returned by GetStorage)
+    /// \param ptr     Object that was constructed with placement new at ValueStorage(storage) (or NULL)
+    ///
+    /// \remarks
+    /// This function should only need to be used when custom constructors are bound with Class::SquirrelFunc.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void SetInstance(HSQUIRRELVM vm, SQInteger idx, void* storage, C* ptr)
+    {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        sq_setinstanceup(vm, idx, new (storage) Header(ptr, cd->instances));
+        sq_setreleasehook(vm, idx, &Delete);
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to set up an instance on the stack for the template class
+    ///
+    /// \param vm VM that has an instance object of the correct type at position 1 in its stack
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger New(HSQUIRRELVM vm) {
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, NewC<C, is_default_constructible<C>::value >(ValueStorage(storage)).p);
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @cond DEV
+    /// following iNew functions are used only if constructors are bound via Ctor() in Sqrat::Class (safe to ignore)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        return New(vm);
+    }
+
+    template <typename A1>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7,typename A8>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        Var<A8> a8(vm, 9);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7,typename A8,typename A9>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        Var<A8> a8(vm, 9);
+        Var<A9> a9(vm, 10);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        void* storage = GetStorage(vm, 1);
+        SetInstance(vm, 1, storage, new (ValueStorage(storage)) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value
+        ));
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    /// @endcond
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to set up the instance at idx on the stack as a copy of a value of the same type
+    ///
+    /// \param vm    VM that has an instance object of the correct type at idx
+    /// \param idx   Index of the stack that the instance object is at
+    /// \param value A pointer to data of the same type as the instance object
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger Copy(HSQUIRRELVM vm, SQInteger idx, const void* value) {
+        void* storage = GetStorage(vm, idx);
+        SetInstance(vm, idx, storage, new (ValueStorage(storage)) C(*static_cast<const C*>(value)));
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to destroy an instance's data (the memory itself belongs to the instance)
+    ///
+    /// \param ptr  Pointer to the data contained by the instance
+    /// \param size Size of the data contained by the instance
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
+        SQUNUSED(size);
+        Header* instance = reinterpret_cast<Header*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
+        if (instance->first != NULL) {
+            instance->first->~C();
+        }
+        instance->~Header();
+        return 0;
+    }
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Counters describing the instance pool of one Class in one VM (see PoolAllocator::GetStats)
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct PoolStats {
+    size_t live;   ///< Blocks currently used by instances
+    size_t pooled; ///< Released blocks kept for reuse
+    size_t peak;   ///< Highest number of live blocks so far
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @cond DEV
+/// Free list of the fixed-size blocks a PoolAllocator places instances of C in (one pool per class per VM)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<class C>
+class InstancePool {
+public:
+
+    typedef std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > > Header;
+
+    // Every block starts with the bookkeeping GetInstance expects, followed by the pool that owns it and then C
+    struct Block {
+        Header                    header;
+        SharedPtr<InstancePool<C> > pool;
+    };
+
+    template <class T>
+    struct Alignment {
+        struct Probe { char c; T t; };
+        enum { value = sizeof(Probe) - sizeof(T) };
+    };
+
+    enum {
+        ValueAlignment = int(Alignment<C>::value),
+        ValueOffset    = (sizeof(Block) + ValueAlignment - 1) / ValueAlignment * ValueAlignment,
+        BlockSize      = ValueOffset + sizeof(C)
+    };
+
+    InstancePool() : m_Free(NULL), m_Live(0), m_Pooled(0), m_Peak(0), m_HighWaterMark(256) {}
+
+    ~InstancePool() {
+        Trim(0);
+    }
+
+    void* Acquire() {
+        void* block;
+        if (m_Free != NULL) {
+            block = m_Free;
+            m_Free = *static_cast<void**>(block);
+            --m_Pooled;
+        } else {
+            block = ::operator new(BlockSize);
+        }
+        if (++m_Live > m_Peak) {
+            m_Peak = m_Live;
+        }
+        return block;
+    }
+
+    void Release(void* block) {
+        --m_Live;
+        if (m_Pooled < m_HighWaterMark) {
+            *static_cast<void**>(block) = m_Free;
+            m_Free = block;
+            ++m_Pooled;
+        } else {
+            ::operator delete(block);
+        }
+    }
+
+    // Frees pooled blocks until at most maxPooled are left
+    void Trim(size_t maxPooled) {
+        while (m_Pooled > maxPooled) {
+            void* block = m_Free;
+            m_Free = *static_cast<void**>(block);
+            ::operator delete(block);
+            --m_Pooled;
+        }
+    }
+
+    void SetHighWaterMark(size_t maxPooled) {
+        m_HighWaterMark = maxPooled;
+        Trim(maxPooled);
+    }
+
+    PoolStats GetStats() const {
+        PoolStats stats;
+        stats.live   = m_Live;
+        stats.pooled = m_Pooled;
+        stats.peak   = m_Peak;
+        return stats;
+    }
+
+private:
+
+    InstancePool(const InstancePool&);
+    InstancePool& operator=(const InstancePool&);
+
+    void*  m_Free; // each pooled block stores the next one in its first bytes
+    size_t m_Live;
+    size_t m_Pooled;
+    size_t m_Peak;
+    size_t m_HighWaterMark;
+};
+/// @endcond
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// PoolAllocator is the allocator to use for Class that can both be constructed and copied and whose instances are
+/// created and released so often that the heap allocations of DefaultAllocator become a problem
+///
+/// \tparam C Type of class
+///
+/// \remarks
+/// The C object and the bookkeeping Sqrat needs for an instance share one fixed-size block. Released blocks go to a free
+/// list that belongs to the class in that VM, so they are reused by the next instance without touching the heap.
+/// Because the pools are per VM, VMs running on different threads never share (or contend for) a free list.
+/// At most SetHighWaterMark blocks (256 by default) are kept pooled, any block released beyond that is freed.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<class C>
+class PoolAllocator {
+
+    typedef InstancePool<C>                 Pool;
+    typedef typename InstancePool<C>::Block Block;
+
+    template <class T, bool b>
+    struct NewC
+    {
+        T* p;
+        NewC(void* storage)
+        {
+           p = new (storage) T();
+        }
+    };
+
+    template <class T>
+    struct NewC<T, false>
+    {
+        T* p;
+        NewC(void*)
+        {
+           p = 0;
+        }
+    };
+
+    static Pool& GetPool(HSQUIRRELVM vm) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        if (!cd->pool) {
+            cd->pool = MakeShared<Pool>();
+        }
+        return *cd->pool;
+    }
+
+    // Gives the block back to the pool unless Commit was called (the constructor of C may throw)
+    class PendingBlock {
+    public:
+        PendingBlock(HSQUIRRELVM vm) : pool(GetPool(vm)), block(pool.Acquire()) {}
+        ~PendingBlock() {
+            if (block != NULL) {
+                pool.Release(block);
+            }
+        }
+        void* Storage() const {
+            return ValueStorage(block);
+        }
+        void* Commit() {
+            void* committed = block;
+            block = NULL;
+            return committed;
+        }
+    private:
+        Pool& pool;
+        void* block;
+        PendingBlock(const PendingBlock&);
+        PendingBlock& operator=(const PendingBlock&);
+    };
+
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the counters of the pool the instances of C use in a VM
+    ///
+    /// \param vm VM that C is bound in
+    ///
+    /// \return Live, pooled and peak block counts
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static PoolStats GetStats(HSQUIRRELVM vm) {
+        return GetPool(vm).GetStats();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets how many released blocks the pool of C keeps in a VM (pooled blocks above the new mark are freed immediately)
+    ///
+    /// \param vm        VM that C is bound in
+    /// \param maxPooled Maximum number of pooled blocks
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void SetHighWaterMark(HSQUIRRELVM vm, size_t maxPooled) {
+        GetPool(vm).SetHighWaterMark(maxPooled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Takes a block from the pool of C (or the heap if the pool is empty)
+    ///
+    /// \param vm VM that C is bound in
+    ///
+    /// \return Block to pass to ValueStorage and SetInstance
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void* Acquire(HSQUIRRELVM vm) {
+        return GetPool(vm).Acquire();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gives a block back to the pool of C when constructing C in it failed
+    ///
+    /// \param vm    VM that C is bound in
+    /// \param block Block returned by Acquire that was not passed to SetInstance
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void Release(HSQUIRRELVM vm, void* block) {
+        GetPool(vm).Release(block);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the address inside a block at which C must be constructed
+    ///
+    /// \param block Block returned by Acquire
+    ///
+    /// \return Address to use with placement new
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void* ValueStorage(void* block) {
+        return static_cast<char*>(block) + Pool::ValueOffset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Associates a newly created instance with an object that was constructed in a pooled block
+    ///
+    /// \param vm    VM that has an instance object of the correct type at idx
+    /// \param idx   Index of the stack that the instance object is at
+    /// \param block Block returned by Acquire
+    /// \param ptr   Object that was constructed with placement new at ValueStorage(block) (or NULL)
+    ///
+    /// \remarks
+    /// This function should only need to be used when custom constructors are bound with Class::SquirrelFunc.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void SetInstance(HSQUIRRELVM vm, SQInteger idx, void* block, C* ptr)
+    {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        Block* b = new (block) Block;
+        b->header.first  = ptr;
+        b->header.second = cd->instances;
+        b->pool          = cd->pool;
+        sq_setinstanceup(vm, idx, b);
+        sq_setreleasehook(vm, idx, &Delete);
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, idx, &((*cd->instances)[ptr]));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to set up an instance on the stack for the template class
+    ///
+    /// \param vm VM that has an instance object of the correct type at position 1 in its stack
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger New(HSQUIRRELVM vm) {
+        PendingBlock block(vm);
+        C* ptr = NewC<C, is_default_constructible<C>::value >(block.Storage()).p;
+        SetInstance(vm, 1, block.Commit(), ptr);
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @cond DEV
+    /// following iNew functions are used only if constructors are bound via Ctor() in Sqrat::Class (safe to ignore)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        return New(vm);
+    }
+
+    template <typename A1>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7,typename A8>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        Var<A8> a8(vm, 9);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    template <typename A1,typename A2,typename A3,typename A4,typename A5,typename A6,typename A7,typename A8,typename A9>
+    static SQInteger iNew(HSQUIRRELVM vm) {
+        SQTRY()
+        Var<A1> a1(vm, 2);
+        Var<A2> a2(vm, 3);
+        Var<A3> a3(vm, 4);
+        Var<A4> a4(vm, 5);
+        Var<A5> a5(vm, 6);
+        Var<A6> a6(vm, 7);
+        Var<A7> a7(vm, 8);
+        Var<A8> a8(vm, 9);
+        Var<A9> a9(vm, 10);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value
+        );
+        SetInstance(vm, 1, block.Commit(), ptr);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+    /// @endcond
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to set up the instance at idx on the stack as a copy of a value of the same type
+    ///
+    /// \param vm    VM that has an instance object of the correct type at idx
+    /// \param idx   Index of the stack that the instance object is at
+    /// \param value A pointer to data of the same type as the instance object
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger Copy(HSQUIRRELVM vm, SQInteger idx, const void* value) {
+        PendingBlock block(vm);
+        C* ptr = new (block.Storage()) C(*static_cast<const C*>(value));
+        SetInstance(vm, idx, block.Commit(), ptr);
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat to delete an instance's data (its block goes back to the pool)
+    ///
+    /// \param ptr  Pointer to the data contained by the instance
+    /// \param size Size of the data contained by the instance
+    ///
+    /// \return Squirrel error code
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SQInteger Delete(SQUserPointer ptr, SQInteger size) {
+        SQUNUSED(size);
+        Block* block = reinterpret_cast<Block*>(ptr);
+        if (block->header.second.Get() != NULL) {
+            block->header.second->Erase(block->header.first);
+        }
+        if (block->header.first != NULL) {
+            block->header.first->~C();
+        }
+        SharedPtr<Pool> pool = block->pool; // the class data of the VM may already be gone so keep the pool alive until the end
+        block->~Block();
+        pool->Release(block);
+        return 0;
+    }
+};
+
 }
 
 #endif
@@ -0,0 +1,470 @@
+//
+// SqratBinding: Recording and Replaying Bindings
+//
+
+//
+// Copyright (c) 2009 Brandon Jones
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+//    1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+//
+//    2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+//    3. This notice may not be removed or altered from any source
+//    distribution.
+//
+
+#if !defined(_SCRAT_BINDING_H_)
+#define _SCRAT_BINDING_H_
+
+#include <squirrel.h>
+#include <string.h>
+#include <vector>
+
+#include "sqratMemberMethods.h"
+#include "sqratOverloadMethods.h"
+#include "sqratUtil.h"
+
+namespace Sqrat
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Records the classes and functions a binding function binds so they can be bound again in other VMs quickly
+///
+/// \remarks
+/// BindingSet::Record runs a binding function once against a scratch VM and keeps a compact list of what it bound.
+/// BindingSet::Apply then replays the list in any VM: each class and table is pushed once for all of its members
+/// and none of the class data lookups Class does for every member are needed.
+///
+/// \remarks
+/// What is recorded: Class and DerivedClass creation and everything bound in them (functions, overloads, constructors,
+/// variables, properties, Squirrel functions, values and TrackInstances), and the functions, overloads, values and classes bound directly
+/// in the root table. Anything else (binding to other tables, ConstTable and Enumeration, instances) is not recorded
+/// and makes IsComplete return false: bind it separately after calling Apply. Only null, bool, integer, float and string
+/// values are recorded.
+///
+/// \remarks
+/// Record is not thread-safe and needs the VM data of Sqrat (it records nothing if compiled with SCRAT_NO_VM_DATA).
+/// Apply can be called from any number of threads once recording is done.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class BindingSet {
+public:
+
+    /// @cond DEV
+
+    // Creates a recorded class in a VM and gives its class object, get table and set table (in that order)
+    typedef void (*CREATEFUNC)(HSQUIRRELVM vm, const SQChar* className, HSQOBJECT* objects);
+
+    // Sets whether a recorded class tracks its instances in a VM (see Class::TrackInstances)
+    typedef void (*TRACKFUNC)(HSQUIRRELVM vm, bool track);
+
+    // Targets of recorded bindings are either the root table or an object of a class: the first target of a class is
+    // its class object, followed by its get table and its set table
+    enum Target {
+        NO_TARGET    = -2,
+        ROOT_TARGET  = -1,
+        CLASS_OBJECT = 0,
+        GET_TABLE    = 1,
+        SET_TABLE    = 2
+    };
+
+    /// @endcond
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Default constructor (nothing recorded)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BindingSet() : classCount(0), complete(true) {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Records the bindings made by a function (bindings recorded before are kept)
+    ///
+    /// \param bind Function or functor called with the scratch VM the bindings are recorded from
+    ///
+    /// \tparam F Type of the function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// The scratch VM is closed when the function returns, so the function must not keep Sqrat objects around.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class F>
+    void Record(F bind) {
+        HSQUIRRELVM vm = sq_open(1024);
+        VMData* vd = VMData::Attach(vm);
+        if (vd != NULL) {
+            recordedSlots.clear();
+            recordedObjects.clear();
+            vd->SetRecorder(this);
+            bind(vm);
+            vd->SetRecorder(NULL);
+        } else {
+            complete = false;
+        }
+        sq_close(vm);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds everything recorded in a VM
+    ///
+    /// \param vm Target VM
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Apply(HSQUIRRELVM vm) const {
+        std::vector<HSQOBJECT> objects(classCount * 3); // kept alive by the class data of the VM
+        int pushed = NO_TARGET;
+        sq_reservestack(vm, 8);
+        for (size_t i = 0; i < ops.size(); ++i) {
+            const Op& op = ops[i];
+            if (op.kind == NEW_CLASS) {
+                op.create(vm, Name(op), &objects[op.target]);
+                continue;
+            }
+            if (op.kind == TRACK_INSTANCES) {
+                op.track(vm, op.integer != 0);
+                continue;
+            }
+            if (op.target != pushed) {
+                if (pushed != NO_TARGET) {
+                    sq_pop(vm, 1);
+                }
+                if (op.target == ROOT_TARGET) {
+                    sq_pushroottable(vm);
+                } else {
+                    sq_pushobject(vm, objects[op.target]);
+                }
+                pushed = op.target;
+            }
+            switch (op.kind) {
+            case FUNC:
+                sq_pushstring(vm, Name(op), -1);
+                memcpy(sq_newuserdata(vm, static_cast<SQUnsignedInteger>(op.dataSize)), Data(op), op.dataSize);
+                sq_newclosure(vm, op.func, 1);
+                sq_newslot(vm, -3, op.staticVar);
+                break;
+            case SQUIRREL_FUNC:
+                sq_pushstring(vm, Name(op), -1);
+                sq_newclosure(vm, op.func, 0);
+                sq_newslot(vm, -3, op.staticVar);
+                break;
+            case OVERLOAD:
+                SqBindOverload(vm, Name(op), Data(op), op.dataSize, op.match, op.func, op.overload, op.argCount, op.staticVar);
+                break;
+            case ACCESSOR:
+                sq_pushstring(vm, Name(op), -1);
+                sqNewAccessor(vm, Data(op), op.dataSize, op.func);
+                sq_newslot(vm, -3, false);
+                break;
+            case VALUE:
+                sq_pushstring(vm, Name(op), -1);
+                PushValue(vm, op);
+                sq_newslot(vm, -3, op.staticVar);
+                break;
+            case BIND_CLASS:
+                sq_pushstring(vm, Name(op), -1);
+                sq_pushobject(vm, objects[op.argCount]);
+                sq_newslot(vm, -3, false);
+                break;
+            default:
+                break;
+            }
+        }
+        if (pushed != NO_TARGET) {
+            sq_pop(vm, 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Returns whether everything the recorded functions bound was recorded
+    ///
+    /// \return False if some bindings were not recorded (see the remarks of BindingSet), otherwise true
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsComplete() const {
+        return complete;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the number of recorded bindings
+    ///
+    /// \return Number of recorded bindings (each class and each member counts as one)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t GetSize() const {
+        return ops.size();
+    }
+
+    /// @cond DEV
+
+    // Gets the BindingSet recording the bindings made in a VM (NULL unless called from BindingSet::Record)
+    static BindingSet* GetRecorder(HSQUIRRELVM vm) {
+        VMData* vd = VMData::Get(vm);
+        return (vd != NULL) ? vd->GetRecorder() : NULL;
+    }
+
+    // Returns whether two objects of the VM are the same object
+    static bool IsSameObject(HSQUIRRELVM vm, HSQOBJECT left, HSQOBJECT right) {
+        sq_pushobject(vm, left);
+        sq_pushobject(vm, right);
+        bool same = (sq_cmp(vm) == 0);
+        sq_pop(vm, 2);
+        return same;
+    }
+
+    // Returns whether an object is the root table of the VM
+    static bool IsRootTable(HSQUIRRELVM vm, HSQOBJECT obj) {
+        sq_pushroottable(vm);
+        HSQOBJECT root;
+        sq_getstackobj(vm, -1, &root);
+        bool same = IsSameObject(vm, root, obj);
+        sq_pop(vm, 1);
+        return same;
+    }
+
+    // Records the creation of a class (nothing if it was recorded already) and returns its first target
+    int RecordClass(unsigned int slot, const SQChar* className, CREATEFUNC create, HSQOBJECT classObj) {
+        int target = ClassTarget(slot);
+        if (target != NO_TARGET) {
+            return target;
+        }
+        target = static_cast<int>(classCount * 3);
+        if (slot >= recordedSlots.size()) {
+            recordedSlots.resize(slot + 1, NO_TARGET);
+        }
+        recordedSlots[slot] = target;
+        recordedObjects.push_back(classObj);
+        ++classCount;
+
+        Op& op = NewOp(NEW_CLASS, target, className, false);
+        op.create = create;
+        return target;
+    }
+
+    // Gets the first target of a recorded class (NO_TARGET if the class was not recorded)
+    int ClassTarget(unsigned int slot) const {
+        return (slot < recordedSlots.size()) ? recordedSlots[slot] : NO_TARGET;
+    }
+
+    // Gets the first target of the class whose class object is obj (NO_TARGET if it is not a recorded class)
+    int ClassTarget(HSQUIRRELVM vm, HSQOBJECT obj) const {
+        for (size_t i = 0; i < recordedObjects.size(); ++i) {
+            if (IsSameObject(vm, recordedObjects[i], obj)) {
+                return static_cast<int>(classCount - recordedObjects.size() + i) * 3;
+            }
+        }
+        return NO_TARGET;
+    }
+
+    void RecordFunc(int target, const SQChar* name, const void* method, size_t methodSize, SQFUNCTION func, bool staticVar) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(FUNC, target, name, staticVar);
+        op.func = func;
+        SetData(op, method, methodSize);
+    }
+
+    void RecordSquirrelFunc(int target, const SQChar* name, SQFUNCTION func) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(SQUIRREL_FUNC, target, name, false);
+        op.func = func;
+    }
+
+    void RecordOverload(int target, const SQChar* name, const void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func, SQFUNCTION overload, SQInteger argCount, bool staticVar) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(OVERLOAD, target, name, staticVar);
+        op.func     = func;
+        op.overload = overload;
+        op.match    = match;
+        op.argCount = argCount;
+        SetData(op, method, methodSize);
+    }
+
+    void RecordAccessor(int target, const SQChar* name, const void* var, size_t varSize, SQFUNCTION func) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(ACCESSOR, target, name, false);
+        op.func = func;
+        SetData(op, var, varSize);
+    }
+
+    // Records the value at idx in the stack of the VM being recorded
+    void RecordValue(HSQUIRRELVM vm, int target, const SQChar* name, SQInteger idx, bool staticVar) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        SQObjectType type = sq_gettype(vm, idx);
+        if (type != OT_NULL && type != OT_BOOL && type != OT_INTEGER && type != OT_FLOAT && type != OT_STRING) {
+            complete = false;
+            return;
+        }
+        Op& op = NewOp(VALUE, target, name, staticVar);
+        op.argCount = static_cast<SQInteger>(type);
+        switch (type) {
+        case OT_BOOL: {
+            SQBool b;
+            sq_getbool(vm, idx, &b);
+            op.integer = b ? 1 : 0;
+            break;
+        }
+        case OT_INTEGER:
+            sq_getinteger(vm, idx, &op.integer);
+            break;
+        case OT_FLOAT:
+            sq_getfloat(vm, idx, &op.number);
+            break;
+        case OT_STRING: {
+            const SQChar* s;
+            sq_getstring(vm, idx, &s);
+            SetData(op, s, static_cast<size_t>(sq_getsize(vm, idx)) * sizeof(SQChar));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    void RecordBindClass(int target, const SQChar* name, int classTarget) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(BIND_CLASS, target, name, false);
+        op.argCount = classTarget;
+    }
+
+    void RecordTrackInstances(int target, TRACKFUNC func, bool track) {
+        if (target == NO_TARGET) {
+            return;
+        }
+        Op& op = NewOp(TRACK_INSTANCES, target, _SC(""), false);
+        op.track   = func;
+        op.integer = track ? 1 : 0;
+    }
+
+    // Notes that something was bound that cannot be recorded
+    void RecordUnsupported() {
+        complete = false;
+    }
+
+    /// @endcond
+
+private:
+
+    enum Kind {
+        NEW_CLASS,
+        FUNC,
+        SQUIRREL_FUNC,
+        OVERLOAD,
+        ACCESSOR,
+        VALUE,
+        BIND_CLASS,
+        TRACK_INSTANCES
+    };
+
+    // One recorded binding; names and member data live in the pools of the BindingSet so an Op stays small
+    struct Op {
+        Kind              kind;
+        int               target;
+        bool              staticVar;
+        size_t            name;      // offset in names
+        size_t            data;      // offset in data
+        size_t            dataSize;
+        SQFUNCTION        func;
+        SQFUNCTION        overload;
+        OVERLOADMATCHFUNC match;
+        SQInteger         argCount;  // also the type of values and the target of bound classes
+        SQInteger         integer;   // also whether a class tracks its instances
+        SQFloat           number;
+        CREATEFUNC        create;
+        TRACKFUNC         track;
+    };
+
+    Op& NewOp(Kind kind, int target, const SQChar* name, bool staticVar) {
+        Op op;
+        op.kind      = kind;
+        op.target    = target;
+        op.staticVar = staticVar;
+        op.name      = names.size();
+        op.data      = 0;
+        op.dataSize  = 0;
+        op.func      = NULL;
+        op.overload  = NULL;
+        op.match     = NULL;
+        op.argCount  = 0;
+        op.integer   = 0;
+        op.number    = 0;
+        op.create    = NULL;
+        op.track     = NULL;
+        names.insert(names.end(), name, name + scstrlen(name) + 1);
+        ops.push_back(op);
+        return ops.back();
+    }
+
+    void SetData(Op& op, const void* ptr, size_t size) {
+        op.data     = data.size();
+        op.dataSize = size;
+        if (size > 0) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(ptr);
+            data.insert(data.end(), bytes, bytes + size);
+        }
+    }
+
+    const SQChar* Name(const Op& op) const {
+        return &names[op.name];
+    }
+
+    const void* Data(const Op& op) const {
+        return (op.dataSize > 0) ? &data[op.data] : NULL;
+    }
+
+    void PushValue(HSQUIRRELVM vm, const Op& op) const {
+        switch (static_cast<SQObjectType>(op.argCount)) {
+        case OT_BOOL:
+            sq_pushbool(vm, op.integer != 0);
+            break;
+        case OT_INTEGER:
+            sq_pushinteger(vm, op.integer);
+            break;
+        case OT_FLOAT:
+            sq_pushfloat(vm, op.number);
+            break;
+        case OT_STRING:
+            sq_pushstring(vm, static_cast<const SQChar*>(Data(op)), static_cast<SQInteger>(op.dataSize / sizeof(SQChar)));
+            break;
+        default:
+            sq_pushnull(vm);
+            break;
+        }
+    }
+
+    std::vector<Op>            ops;
+    std::vector<SQChar>        names;
+    std::vector<unsigned char> data;
+    size_t                     classCount;
+    bool                       complete;
+
+    // Only used while recording
+    std::vector<int>           recordedSlots;   // first target of the classes recorded from the scratch VM by class slot
+    std::vector<HSQOBJECT>     recordedObjects; // class objects of those classes in the scratch VM
+};
+
+}
+
+#endif
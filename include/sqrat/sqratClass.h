@@ -35,7 +35,9 @@
 #include "sqratObject.h"
 #include "sqratClassType.h"
 #include "sqratMemberMethods.h"
+#include "sqratUncheckedMethods.h"
 #include "sqratAllocator.h"
+#include "sqratBinding.h"
 #include "sqratTypes.h"
 
 namespace Sqrat
@@ -80,14 +82,17 @@ public:
     /// \param className   A necessarily unique name for the class that can appear in error messages
     /// \param createClass Should class type data be created? (almost always should be true - don't worry about it)
     ///
+    /// \remarks
+    /// The className given the first time C is bound is used for C in every VM for the rest of the process.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Class(HSQUIRRELVM v, const string& className, bool createClass = true) : Object(v, false) {
         if (createClass && !ClassType<C>::hasClassData(v)) {
             sq_pushregistrytable(v);
-            sq_pushstring(v, "__classes", -1);
+            sq_pushstring(v, _SC("__classes"), -1);
             if (SQ_FAILED(sq_rawget(v, -2))) {
                 sq_newtable(v);
-                sq_pushstring(v, "__classes", -1);
+                sq_pushstring(v, _SC("__classes"), -1);
                 sq_push(v, -2);
                 sq_rawset(v, -4);
             }
@@ -100,15 +105,14 @@ public:
 
             ClassData<C>* cd = *ud;
 
-            if (ClassType<C>::getStaticClassData().Expired()) {
-                cd->staticData.Init(new StaticClassData<C, void>);
-                cd->staticData->copyFunc  = &A::Copy;
-                cd->staticData->className = string(className);
-                cd->staticData->baseClass = NULL;
+            cd->staticData = ClassType<C>::getStaticClassData();
+            if (cd->staticData == NULL) {
+                AbstractStaticClassData* staticData = new StaticClassData<C, void>;
+                staticData->copyFunc  = &A::Copy;
+                staticData->className = string(className);
+                staticData->baseClass = NULL;
 
-                ClassType<C>::getStaticClassData() = cd->staticData;
-            } else {
-                cd->staticData = ClassType<C>::getStaticClassData().Lock();
+                cd->staticData = ClassType<C>::setStaticClassData(staticData);
             }
 
             HSQOBJECT& classObj = cd->classObj;
@@ -119,6 +123,11 @@ public:
             sq_addref(v, &classObj); // must addref before the pop!
             sq_pop(v, 1);
             InitClass(cd);
+
+            BindingSet* recorder = BindingSet::GetRecorder(v);
+            if (recorder != NULL) {
+                recorder->RecordClass(ClassType<C>::getClassSlot(), className.c_str(), &Class::ReplayClass, classObj);
+            }
         }
     }
 
@@ -181,6 +190,28 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets whether Sqrat keeps track of which Squirrel instance owns which C++ object of this class (on by default)
+    ///
+    /// \param track Should instances be tracked?
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /// \remarks
+    /// Tracking is what makes pushing the same C* twice push the same Squirrel instance. Without it every push creates a
+    /// new instance, but creating and releasing instances no longer has to update a map that grows with the live instance count.
+    /// Only instances created after the call are affected, so this is best called right after the Class is constructed.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Class& TrackInstances(bool track) {
+        SetTrackInstances(vm, track);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordTrackInstances(RecordedTarget(recorder, BindingSet::CLASS_OBJECT), &Class::SetTrackInstances, track);
+        }
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Binds a class variable
     ///
@@ -209,6 +240,38 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds a class variable whose member pointer is known at compile time
+    ///
+    /// \param name Name of the variable as it will appear in Squirrel
+    ///
+    /// \tparam V   Type of variable
+    /// \tparam var Variable to bind
+    ///
+    /// \remarks
+    /// Works like the other Var but the accessors are instantiated for the given member, so reading or writing it from
+    /// Squirrel is a direct load or store instead of going through a member pointer stored in the VM. Use it as in
+    /// cls.Var<float, &Vec3::x>(_SC("x")) (with C++11 the type can be spelled decltype(&Vec3::x) rather than by hand).
+    ///
+    /// \remarks
+    /// If V is not a pointer or reference, then it must have a default constructor.
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class V, V C::* var>
+    Class& Var(const SQChar* name) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+
+        // Add the getter
+        BindAccessor(name, NULL, 0, &sqFieldGet<C, V, var>, cd->getTable);
+
+        // Add the setter
+        BindAccessor(name, NULL, 0, &sqFieldSet<C, V, var>, cd->setTable);
+
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Binds a class variable without a setter
     ///
@@ -234,6 +297,30 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds a class variable whose member pointer is known at compile time without a setter
+    ///
+    /// \param name Name of the variable as it will appear in Squirrel
+    ///
+    /// \tparam V   Type of variable
+    /// \tparam var Variable to bind
+    ///
+    /// \remarks
+    /// See the Var that takes the member pointer as a template argument.
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class V, V C::* var>
+    Class& ConstVar(const SQChar* name) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+
+        // Add the getter
+        BindAccessor(name, NULL, 0, &sqFieldGet<C, V, var>, cd->getTable);
+
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Bind a class static variable
     ///
@@ -389,6 +476,32 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds a class function that is called without any error checking
+    ///
+    /// \param name   Name of the function as it will appear in Squirrel
+    /// \param method Function to bind
+    ///
+    /// \tparam F Type of function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /// \remarks
+    /// Unlike Func, the function does not check the number of arguments it is called with nor the types of numbers and
+    /// does not look for errors while reading its arguments. It is meant for trusted functions on hot paths only: calling
+    /// it with arguments that do not match it is undefined behavior, and the function itself must not throw.
+    /// An error raised while reading an argument that is not a number is discarded (once per call, and only by functions
+    /// that have such an argument) so that it does not fail the next checked call, or with SCRAT_USE_EXCEPTIONS defined,
+    /// becomes a Squirrel error raised by the function.
+    /// Calling it on something that is not a constructed instance of the class raises a Squirrel error.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class F>
+    Class& FuncUnchecked(const SQChar* name, F method) {
+        BindFunc(name, &method, sizeof(method), SqMemberUncheckedFunc(method));
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Binds a class function with overloading enabled
     ///
@@ -400,13 +513,13 @@ public:
     /// \return The Class itself so the call can be chained
     ///
     /// \remarks
-    /// Overloading in this context means to allow the function name to be used with functions
-    /// of a different number of arguments. This definition differs from others (e.g. C++'s).
+    /// Overloads are chosen by the number of arguments and then by their types. Functions taking the same
+    /// number of arguments are told apart by the Squirrel types of the values passed and by the bound classes of instances.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class F>
     Class& Overload(const SQChar* name, F method) {
-        BindOverload(name, &method, sizeof(method), SqMemberOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
+        BindOverload(name, &method, sizeof(method), SqOverloadMatchFunc(method), SqMemberOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
         return *this;
     }
 
@@ -427,6 +540,26 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds a global function as a class function that is called without any error checking
+    ///
+    /// \param name   Name of the function as it will appear in Squirrel
+    /// \param method Function to bind
+    ///
+    /// \tparam F Type of function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /// \remarks
+    /// See FuncUnchecked.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class F>
+    Class& GlobalFuncUnchecked(const SQChar* name, F method) {
+        BindFunc(name, &method, sizeof(method), SqMemberGlobalUncheckedFunc(method));
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Binds a static class function
     ///
@@ -444,6 +577,26 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Binds a static class function that is called without any error checking
+    ///
+    /// \param name   Name of the function as it will appear in Squirrel
+    /// \param method Function to bind
+    ///
+    /// \tparam F Type of function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return The Class itself so the call can be chained
+    ///
+    /// \remarks
+    /// See FuncUnchecked.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class F>
+    Class& StaticFuncUnchecked(const SQChar* name, F method) {
+        BindFunc(name, &method, sizeof(method), SqGlobalUncheckedFunc(method));
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Binds a global function as a class function with overloading enabled
     ///
@@ -455,13 +608,13 @@ public:
     /// \return The Class itself so the call can be chained
     ///
     /// \remarks
-    /// Overloading in this context means to allow the function name to be used with functions
-    /// of a different number of arguments. This definition differs from others (e.g. C++'s).
+    /// Overloads are chosen by the number of arguments and then by their types. Functions taking the same
+    /// number of arguments are told apart by the Squirrel types of the values passed and by the bound classes of instances.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class F>
     Class& GlobalOverload(const SQChar* name, F method) {
-        BindOverload(name, &method, sizeof(method), SqMemberGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method) - 1);
+        BindOverload(name, &method, sizeof(method), SqMemberGlobalOverloadMatchFunc(method), SqMemberGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method) - 1);
         return *this;
     }
 
@@ -476,13 +629,13 @@ public:
     /// \return The Class itself so the call can be chained
     ///
     /// \remarks
-    /// Overloading in this context means to allow the function name to be used with functions
-    /// of a different number of arguments. This definition differs from others (e.g. C++'s).
+    /// Overloads are chosen by the number of arguments and then by their types. Functions taking the same
+    /// number of arguments are told apart by the Squirrel types of the values passed and by the bound classes of instances.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class F>
     Class& StaticOverload(const SQChar* name, F method) {
-        BindOverload(name, &method, sizeof(method), SqGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
+        BindOverload(name, &method, sizeof(method), SqOverloadMatchFunc(method), SqGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
         return *this;
     }
 
@@ -506,6 +659,11 @@ public:
         sq_newslot(vm, -3, false);
         sq_pop(vm, 1); // pop table
 
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordSquirrelFunc(RecordedTarget(recorder, BindingSet::CLASS_OBJECT), name, func);
+        }
+
         return *this;
     }
 
@@ -541,10 +699,104 @@ public:
         return ret;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets a Function from a key in the Class
+    ///
+    /// \param name The interned key in the class that contains the Function
+    ///
+    /// \return Function found in the Class (null if failed)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Function GetFunction(const Key& name) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        HSQOBJECT funcObj;
+        sq_pushobject(vm, cd->classObj);
+        name.Push(vm);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if(SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            return Function();
+        }
+        SQObjectType value_type = sq_gettype(vm, -1);
+        if (value_type != OT_CLOSURE && value_type != OT_NATIVECLOSURE) {
+            sq_pop(vm, 2);
+            return Function();
+        }
+#else
+        sq_get(vm, -2);
+#endif
+        sq_getstackobj(vm, -1, &funcObj);
+        Function ret(vm, cd->classObj, funcObj); // must addref before the pop!
+        sq_pop(vm, 2);
+        return ret;
+    }
+
 protected:
 
 /// @cond DEV
 
+    // Creates the class in a VM BindingSet::Apply replays it in
+    static void ReplayClass(HSQUIRRELVM vm, const SQChar* className, HSQOBJECT* objects) {
+        Class<C, A> cls(vm, className);
+        GetReplayObjects(vm, objects);
+    }
+
+    // Implements TrackInstances (also called by BindingSet::Apply)
+    static void SetTrackInstances(HSQUIRRELVM vm, bool track) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        if (!track) {
+            cd->instances.Reset();
+        } else if (cd->instances.Get() == NULL) {
+            cd->instances = MakeShared<PointerMap<C*, HSQOBJECT> >();
+        }
+    }
+
+    // Gives BindingSet::Apply the objects the members of the class are bound to
+    static void GetReplayObjects(HSQUIRRELVM vm, HSQOBJECT* objects) {
+        ClassData<C>* cd = ClassType<C>::getClassData(vm);
+        objects[BindingSet::CLASS_OBJECT] = cd->classObj;
+        objects[BindingSet::GET_TABLE]    = cd->getTable;
+        objects[BindingSet::SET_TABLE]    = cd->setTable;
+    }
+
+    // Gets the target of a BindingSet that is the class object, get table or set table of the class
+    static int RecordedTarget(BindingSet* recorder, int table) {
+        int target = recorder->ClassTarget(ClassType<C>::getClassSlot());
+        if (target == BindingSet::NO_TARGET) { // the class was bound before the recording started
+            recorder->RecordUnsupported();
+            return BindingSet::NO_TARGET;
+        }
+        return target + table;
+    }
+
+    // Binding helpers of Object that also record the binding if the VM is being recorded by a BindingSet
+    inline void BindFunc(const SQChar* name, void* method, size_t methodSize, SQFUNCTION func, bool staticVar = false) {
+        Object::BindFunc(name, method, methodSize, func, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordFunc(RecordedTarget(recorder, BindingSet::CLASS_OBJECT), name, method, methodSize, func, staticVar);
+        }
+    }
+
+    inline void BindOverload(const SQChar* name, void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func, SQFUNCTION overload, int argCount, bool staticVar = false) {
+        Object::BindOverload(name, method, methodSize, match, func, overload, argCount, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordOverload(RecordedTarget(recorder, BindingSet::CLASS_OBJECT), name, method, methodSize, match, func, overload, argCount, staticVar);
+        }
+    }
+
+    template<class V>
+    inline void BindValue(const SQChar* name, const V& val, bool staticVar = false) {
+        Object::BindValue<V>(name, val, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            PushVar(vm, val);
+            recorder->RecordValue(vm, RecordedTarget(recorder, BindingSet::CLASS_OBJECT), name, -1, staticVar);
+            sq_pop(vm, 1);
+        }
+    }
+
     static SQInteger ClassWeakref(HSQUIRRELVM vm) {
         sq_weakref(vm, -1);
         return 1;
@@ -578,13 +830,18 @@ protected:
 
     // Initialize the required data structure for the class
     void InitClass(ClassData<C>* cd) {
-        cd->instances.Init(new typename unordered_map<C*, HSQOBJECT>::type);
+        cd->instances = MakeShared<PointerMap<C*, HSQOBJECT> >();
 
         // push the class
         sq_pushobject(vm, cd->classObj);
 
         // set the typetag of the class
-        sq_settypetag(vm, -1, cd->staticData.Get());
+        sq_settypetag(vm, -1, cd->staticData);
+
+        // reserve the memory of allocators that store C inside the instance
+        if (instance_user_data_size<A>::value > 0) {
+            sq_setclassudsize(vm, -1, instance_user_data_size<A>::value);
+        }
 
         // add the default constructor
         sq_pushstring(vm, _SC("constructor"), -1);
@@ -641,33 +898,34 @@ protected:
     }
 
     // Helper function used to bind getters and setters
-    inline void BindAccessor(const SQChar* name, void* var, size_t varSize, SQFUNCTION func, HSQOBJECT table) {
+    inline void BindAccessor(const SQChar* name, const void* var, size_t varSize, SQFUNCTION func, HSQOBJECT table) {
         // Push the get or set table
         sq_pushobject(vm, table);
         sq_pushstring(vm, name, -1);
 
-        // Push the variable offset as a free variable
-        SQUserPointer varPtr = sq_newuserdata(vm, static_cast<SQUnsignedInteger>(varSize));
-        memcpy(varPtr, var, varSize);
-
-        // Create the accessor function
-        sq_newclosure(vm, func, 1);
+        // Push the variable offset and the accessor function as a descriptor (_get and _set call it without a closure)
+        sqNewAccessor(vm, var, varSize, func);
 
         // Add the accessor to the table
         sq_newslot(vm, -3, false);
 
         // Pop get/set table
         sq_pop(vm, 1);
+
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            bool getter = BindingSet::IsSameObject(vm, table, ClassType<C>::getClassData(vm)->getTable);
+            recorder->RecordAccessor(RecordedTarget(recorder, getter ? BindingSet::GET_TABLE : BindingSet::SET_TABLE), name, var, varSize, func);
+        }
     }
 
     // constructor binding
-    Class& BindConstructor(SQFUNCTION method, SQInteger nParams, const SQChar *name = 0) {
+    Class& BindConstructor(SQFUNCTION method, OVERLOADMATCHFUNC match, SQInteger nParams, const SQChar *name = 0) {
         SQFUNCTION overload = SqOverloadFunc(method);
         bool alternative_global = false;
         if (name == 0)
             name = _SC("constructor");
         else alternative_global = true;
-        string overloadName = SqOverloadName::Get(name, nParams);
 
         if (!alternative_global )
         {
@@ -680,18 +938,15 @@ protected:
             sq_pushroottable(vm);
         }
 
-        // Bind overload handler
-        sq_pushstring(vm, name, -1);
-        sq_pushstring(vm, name, -1); // function name is passed as a free variable
-        sq_newclosure(vm, overload, 1);
-        sq_newslot(vm, -3, false);
-
-        // Bind overloaded allocator function
-        sq_pushstring(vm, overloadName.c_str(), -1);
-        sq_newclosure(vm, method, 0);
-        sq_setparamscheck(vm,nParams + 1,NULL);
-        sq_newslot(vm, -3, false);
+        // Bind the allocator function as the overload taking nParams arguments
+        SqBindOverload(vm, name, NULL, 0, match, method, overload, nParams);
         sq_pop(vm, 1);
+
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            int target = alternative_global ? static_cast<int>(BindingSet::ROOT_TARGET) : RecordedTarget(recorder, BindingSet::CLASS_OBJECT);
+            recorder->RecordOverload(target, name, NULL, 0, match, method, overload, nParams, false);
+        }
         return *this;
     }
 
@@ -708,7 +963,7 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::iNew, 0, name);
+        return BindConstructor(A::iNew, &SqOverloadMatch<2>::Score, 0, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -723,7 +978,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1>, 1, name);
+        return BindConstructor(A::template iNew<A1>, &SqOverloadMatch<2, A1>::Score, 1, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -739,7 +994,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2>, 2, name);
+        return BindConstructor(A::template iNew<A1, A2>, &SqOverloadMatch<2, A1, A2>::Score, 2, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -756,7 +1011,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3>, 3, name);
+        return BindConstructor(A::template iNew<A1, A2, A3>, &SqOverloadMatch<2, A1, A2, A3>::Score, 3, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -774,7 +1029,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4>, 4, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4>, &SqOverloadMatch<2, A1, A2, A3, A4>::Score, 4, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -793,7 +1048,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4, class A5>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5>, 5, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5>, &SqOverloadMatch<2, A1, A2, A3, A4, A5>::Score, 5, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -813,7 +1068,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4, class A5, class A6>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6>, 6, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6>, &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6>::Score, 6, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -834,7 +1089,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4, class A5, class A6, class A7>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7>, 7, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7>, &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7>::Score, 7, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -856,7 +1111,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7, A8>, 8, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7, A8>, &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8>::Score, 8, name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,7 +1134,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
     Class& Ctor(const SQChar *name = 0) {
-        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7, A8, A9>, 9, name);
+        return BindConstructor(A::template iNew<A1, A2, A3, A4, A5, A6, A7, A8, A9>, &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9>::Score, 9, name);
     }
 };
 
@@ -932,10 +1187,10 @@ public:
     DerivedClass(HSQUIRRELVM v, const string& className) : Class<C, A>(v, string(), false) {
         if (!ClassType<C>::hasClassData(v)) {
             sq_pushregistrytable(v);
-            sq_pushstring(v, "__classes", -1);
+            sq_pushstring(v, _SC("__classes"), -1);
             if (SQ_FAILED(sq_rawget(v, -2))) {
                 sq_newtable(v);
-                sq_pushstring(v, "__classes", -1);
+                sq_pushstring(v, _SC("__classes"), -1);
                 sq_push(v, -2);
                 sq_rawset(v, -4);
             }
@@ -949,15 +1204,15 @@ public:
             ClassData<B>* bd = ClassType<B>::getClassData(v);
             ClassData<C>* cd = *ud;
 
-            if (ClassType<C>::getStaticClassData().Expired()) {
-                cd->staticData.Init(new StaticClassData<C, B>);
-                cd->staticData->copyFunc  = &A::Copy;
-                cd->staticData->className = string(className);
-                cd->staticData->baseClass = bd->staticData.Get();
+            cd->staticData = ClassType<C>::getStaticClassData();
+            if (cd->staticData == NULL) {
+                StaticClassData<C, B>* staticData = new StaticClassData<C, B>;
+                staticData->copyFunc  = &A::Copy;
+                staticData->className = string(className);
+                staticData->baseClass = bd->staticData;
+                staticData->InheritCasts(bd->staticData);
 
-                ClassType<C>::getStaticClassData() = cd->staticData;
-            } else {
-                cd->staticData = ClassType<C>::getStaticClassData().Lock();
+                cd->staticData = ClassType<C>::setStaticClassData(staticData);
             }
 
             HSQOBJECT& classObj = cd->classObj;
@@ -969,6 +1224,11 @@ public:
             sq_addref(v, &classObj); // must addref before the pop!
             sq_pop(v, 1);
             InitDerivedClass(v, cd, bd);
+
+            BindingSet* recorder = BindingSet::GetRecorder(v);
+            if (recorder != NULL) {
+                recorder->RecordClass(ClassType<C>::getClassSlot(), className.c_str(), &DerivedClass::ReplayDerivedClass, classObj);
+            }
         }
     }
 
@@ -976,14 +1236,23 @@ protected:
 
 /// @cond DEV
 
+    // Creates the class in a VM BindingSet::Apply replays it in
+    static void ReplayDerivedClass(HSQUIRRELVM vm, const SQChar* className, HSQOBJECT* objects) {
+        DerivedClass<C, B, A> cls(vm, className);
+        Class<C, A>::GetReplayObjects(vm, objects);
+    }
+
     void InitDerivedClass(HSQUIRRELVM vm, ClassData<C>* cd, ClassData<B>* bd) {
-        cd->instances.Init(new typename unordered_map<C*, HSQOBJECT>::type);
+        cd->instances = MakeShared<PointerMap<C*, HSQOBJECT> >();
 
         // push the class
         sq_pushobject(vm, cd->classObj);
 
         // set the typetag of the class
-        sq_settypetag(vm, -1, cd->staticData.Get());
+        sq_settypetag(vm, -1, cd->staticData);
+
+        // reserve the memory of allocators that store C inside the instance (always set since the size of the base is inherited)
+        sq_setclassudsize(vm, -1, instance_user_data_size<A>::value);
 
         // add the default constructor
         sq_pushstring(vm, _SC("constructor"), -1);
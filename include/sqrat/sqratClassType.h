@@ -29,7 +29,9 @@
 #define _SCRAT_CLASSTYPE_H_
 
 #include <squirrel.h>
+#include <cstddef>
 #include <typeinfo>
+#include <vector>
 
 #include "sqratUtil.h"
 
@@ -41,63 +43,209 @@ namespace Sqrat
 // The copy function for a class
 typedef SQInteger (*COPYFUNC)(HSQUIRRELVM, SQInteger, const void*);
 
+// Casts a pointer to an instance of a class to a pointer to its direct base class
+typedef SQUserPointer (*UPCASTFUNC)(SQUserPointer);
+
 // Every Squirrel class instance made by Sqrat has its type tag set to a AbstractStaticClassData object that is unique per C++ class
 struct AbstractStaticClassData {
-    AbstractStaticClassData() {}
+    AbstractStaticClassData() : offsetDepth(0) {}
     virtual ~AbstractStaticClassData() {}
-    virtual SQUserPointer Cast(SQUserPointer ptr, SQUserPointer classType) = 0;
+
+    // Casts ptr to classType (one of the bases of this class) with the adjustment precomputed for that base when the class
+    // was bound. Only bases beyond a virtual base need the upcasts to be run one by one
+    SQUserPointer Cast(SQUserPointer ptr, SQUserPointer classType) {
+        size_t targetDepth = static_cast<AbstractStaticClassData*>(classType)->upcasts.size();
+        if (targetDepth >= offsetDepth) {
+            return static_cast<char*>(ptr) + offsets[targetDepth];
+        }
+        size_t depth = upcasts.size();
+        if (offsetDepth < depth) {
+            ptr = static_cast<char*>(ptr) + offsets[offsetDepth];
+            depth = offsetDepth;
+        }
+        for (; depth > targetDepth; --depth) {
+            ptr = upcasts[depth - 1](ptr);
+        }
+        return ptr;
+    }
+
+    // Sets up the casts of a class that directly derives from base (step casts from the class to base)
+    void InheritCasts(AbstractStaticClassData* base, UPCASTFUNC upcast, bool virtualBase, ptrdiff_t offset) {
+        size_t baseDepth = base->upcasts.size();
+        upcasts = base->upcasts;
+        upcasts.push_back(upcast);
+        offsets.assign(baseDepth + 1, 0);
+        if (virtualBase) { // the adjustment depends on the object so no base can be reached with an offset
+            offsetDepth = baseDepth + 1;
+            return;
+        }
+        for (size_t depth = base->offsetDepth; depth < baseDepth; ++depth) {
+            offsets[depth] = base->offsets[depth] + offset;
+        }
+        offsets[baseDepth] = offset;
+        offsetDepth = base->offsetDepth;
+    }
+
     AbstractStaticClassData* baseClass;
     string                   className;
     COPYFUNC                 copyFunc;
+    std::vector<UPCASTFUNC>  upcasts;     // upcasts[i] casts from the base class at depth i + 1 to the one at depth i (the root is at depth 0)
+    std::vector<ptrdiff_t>   offsets;     // offsets[i] adjusts a pointer to this class to one to its base class at depth i
+    size_t                   offsetDepth; // offsets[i] is only valid for i >= offsetDepth (the bases past the nearest virtual base)
+};
+
+// Tells whether B is a virtual base of C: static_cast can only cast from B* back down to C* if it is not
+template<class C, class B>
+struct IsVirtualBase {
+    template<int N> struct Probe {};
+    template<class D> static char Test(Probe<sizeof(static_cast<D*>(static_cast<B*>(0)))>*);
+    template<class D> static long Test(...);
+    static const bool value = sizeof(Test<C>(0)) != sizeof(char);
 };
 
 // StaticClassData keeps track of the nearest base class B and the class associated with itself C in order to cast C++ pointers to the right base class
 template<class C, class B>
 struct StaticClassData : public AbstractStaticClassData {
-    virtual SQUserPointer Cast(SQUserPointer ptr, SQUserPointer classType) {
-        if (classType != this) {
-            ptr = baseClass->Cast(static_cast<B*>(static_cast<C*>(ptr)), classType);
+    static SQUserPointer Upcast(SQUserPointer ptr) {
+        return static_cast<B*>(static_cast<C*>(ptr));
+    }
+
+    // Sets up the casts of C to B and the bases of B
+    void InheritCasts(AbstractStaticClassData* base) {
+        ptrdiff_t offset = 0;
+        if (!IsVirtualBase<C, B>::value) { // the pointer is never dereferenced when casting to a non-virtual base
+            char* probe = reinterpret_cast<char*>(sizeof(void*) * 64);
+            offset = reinterpret_cast<char*>(static_cast<B*>(reinterpret_cast<C*>(probe))) - probe;
         }
-        return ptr;
+        AbstractStaticClassData::InheritCasts(base, &Upcast, IsVirtualBase<C, B>::value, offset);
     }
 };
 
+// Free list of the blocks PoolAllocator places instances in (defined in sqratAllocator.h)
+template<class C>
+class InstancePool;
+
 // Every Squirrel class object created by Sqrat in every VM has its own unique ClassData object stored in the registry table of the VM
 template<class C>
 struct ClassData {
     HSQOBJECT classObj;
     HSQOBJECT getTable;
     HSQOBJECT setTable;
-    SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> instances;
-    SharedPtr<AbstractStaticClassData> staticData;
+    SharedPtr<PointerMap<C*, HSQOBJECT> > instances; // NULL for classes bound with Class::TrackInstances(false)
+    AbstractStaticClassData* staticData; // shared by every VM C is bound in (see StaticClassEntry)
+    SharedPtr<InstancePool<C> > pool; // only created for classes bound with PoolAllocator
+};
+
+// Registry entry of a C++ class, created the first time the class is used and never freed so it can be read without a lock
+//
+// The entries and the static class data they point to are deliberately leaked (one small allocation per bound C++ class):
+// ClassType caches them in function-local statics and VMs may still be closed by other static destructors at exit, so
+// freeing them at shutdown could not be done safely. As a consequence the class name and base class given by the first
+// Sqrat::Class bound for a C++ class are kept for the whole process, even after every VM it was bound in is closed.
+struct StaticClassEntry {
+    AtomicPtr<AbstractStaticClassData> data; // set once by the first Sqrat::Class bound for the class (NULL before)
+    unsigned int                       slot; // index of the class data in the per-VM class data cache (see VMData)
 };
 
 // Lookup static class data by type_info rather than a template because C++ cannot export generic templates
+// Only called once per class and thread: ClassType caches the entry it returns
 class _ClassType_helper {
 public:
 #if defined(SCRAT_IMPORT)
-    static SQRAT_API WeakPtr<AbstractStaticClassData>& _getStaticClassData(const std::type_info* type);
+    static SQRAT_API StaticClassEntry* _getStaticClassEntry(const std::type_info* type);
+    static SQRAT_API AbstractStaticClassData* _setStaticClassData(StaticClassEntry* entry, AbstractStaticClassData* data);
 #else
     struct compare_type_info {
         bool operator ()(const std::type_info* left, const std::type_info* right) const {
             return left->before(*right) != 0;
         }
     };
-    static SQRAT_API WeakPtr<AbstractStaticClassData>& _getStaticClassData(const std::type_info* type) {
-        static std::map<const std::type_info*, WeakPtr<AbstractStaticClassData>, compare_type_info> data;
-        return data[type];
+    typedef std::map<const std::type_info*, StaticClassEntry*, compare_type_info> EntryMap;
+
+    static SpinLock& _getLock() {
+        static SpinLock lock; // zero initialized, so it is ready before any thread binds a class
+        return lock;
+    }
+    static SQRAT_API StaticClassEntry* _getStaticClassEntry(const std::type_info* type) {
+        static EntryMap* entries = NULL; // created under the lock: the constructor of a static map is not thread-safe before C++11
+        static unsigned int slots = 0;
+        SpinLockGuard guard(_getLock());
+        if (entries == NULL) {
+            entries = new EntryMap;
+        }
+        StaticClassEntry*& entry = (*entries)[type];
+        if (entry == NULL) {
+            entry = new StaticClassEntry;
+            entry->data.Store(NULL);
+            entry->slot = slots++;
+        }
+        return entry;
+    }
+    // Sets the static class data of the entry unless another thread did first, returns the data the entry ends up with
+    static SQRAT_API AbstractStaticClassData* _setStaticClassData(StaticClassEntry* entry, AbstractStaticClassData* data) {
+        SpinLockGuard guard(_getLock());
+        AbstractStaticClassData* current = entry->data.Load();
+        if (current != NULL) {
+            return current;
+        }
+        entry->data.Store(data);
+        return data;
     }
 #endif
 };
 
+// Returns the static class data of the native class of the instance or class at idx. Squirrel classes that extend a native
+// class have no type tag of their own, so their nearest native base is looked up once and cached in the data of the VM
+// (returns NULL if the value is not of a class bound by Sqrat)
+inline AbstractStaticClassData* GetNativeClassData(HSQUIRRELVM vm, SQInteger idx) {
+    AbstractStaticClassData* classData = NULL;
+    SQObjectType type = sq_gettype(vm, idx);
+    if (type != OT_INSTANCE && type != OT_CLASS) {
+        return NULL;
+    }
+    sq_gettypetag(vm, idx, (SQUserPointer*)&classData);
+    if (classData != NULL) {
+        return classData;
+    }
+    SQInteger top = sq_gettop(vm);
+    if (type == OT_INSTANCE) {
+        sq_getclass(vm, idx);
+    } else {
+        sq_push(vm, idx);
+    }
+    HSQOBJECT cls;
+    sq_getstackobj(vm, -1, &cls);
+    VMData* vd = VMData::Attach(vm);
+    void** cached = (vd != NULL) ? vd->FindNativeClassData(cls) : NULL;
+    if (cached != NULL) {
+        classData = static_cast<AbstractStaticClassData*>(*cached);
+    } else {
+        while (classData == NULL && SQ_SUCCEEDED(sq_getbase(vm, -1)) && sq_gettype(vm, -1) == OT_CLASS) {
+            sq_gettypetag(vm, -1, (SQUserPointer*)&classData);
+        }
+        if (vd != NULL) {
+            vd->SetNativeClassData(vm, cls, classData);
+        }
+    }
+    sq_settop(vm, top);
+    return classData;
+}
+
 // Internal helper class for managing classes
 template<class C>
 class ClassType {
 public:
 
     static inline ClassData<C>* getClassData(HSQUIRRELVM vm) {
+        VMData* vd = VMData::Get(vm);
+        if (vd != NULL) {
+            ClassData<C>* cd = static_cast<ClassData<C>*>(vd->GetClassData(getClassSlot()));
+            if (cd != NULL) {
+                return cd;
+            }
+        }
         sq_pushregistrytable(vm);
-        sq_pushstring(vm, "__classes", -1);
+        VMData::PushKey(vm, vd, _SC("__classes"));
 #ifndef NDEBUG
         SQRESULT r = sq_rawget(vm, -2);
         assert(SQ_SUCCEEDED(r)); // fails if getClassData is called when the data does not exist for the given VM yet (bind the class)
@@ -114,21 +262,61 @@ public:
         ClassData<C>** ud;
         sq_getuserdata(vm, -1, (SQUserPointer*)&ud, NULL);
         sq_pop(vm, 3);
+        vd = VMData::Attach(vm);
+        if (vd != NULL) {
+            vd->SetClassData(getClassSlot(), *ud);
+        }
         return *ud;
     }
 
-    static WeakPtr<AbstractStaticClassData>& getStaticClassData() {
-        return _ClassType_helper::_getStaticClassData(&typeid(C));
+    // Registry entry of C: one map search per thread the first time, then a single load
+    static StaticClassEntry* getStaticClassEntry() {
+        static AtomicPtr<StaticClassEntry> cache; // zero initialized, no guard needed
+        StaticClassEntry* entry = cache.Load();
+        if (entry == NULL) {
+            entry = _ClassType_helper::_getStaticClassEntry(&typeid(C));
+            cache.Store(entry); // threads racing here store the same pointer
+        }
+        return entry;
+    }
+
+    // Returns the static class data of C (NULL if no Sqrat::Class was bound for C yet)
+    static AbstractStaticClassData* getStaticClassData() {
+        return getStaticClassEntry()->data.Load();
+    }
+
+    // Sets the static class data of C if it has none yet, otherwise deletes data; returns the data of C either way
+    static AbstractStaticClassData* setStaticClassData(AbstractStaticClassData* data) {
+        AbstractStaticClassData* current = _ClassType_helper::_setStaticClassData(getStaticClassEntry(), data);
+        if (current != data) {
+            delete data; // another thread bound C first
+        }
+        return current;
+    }
+
+    // Index of the class data of C in the per-VM class data cache (see VMData)
+    static unsigned int getClassSlot() {
+        return getStaticClassEntry()->slot;
     }
 
     static inline bool hasClassData(HSQUIRRELVM vm) {
-        if (!getStaticClassData().Expired()) {
+        VMData* vd = VMData::Get(vm);
+        if (vd != NULL && vd->GetClassData(getClassSlot()) != NULL) {
+            return true;
+        }
+        if (getStaticClassData() != NULL) {
             sq_pushregistrytable(vm);
-            sq_pushstring(vm, "__classes", -1);
+            VMData::PushKey(vm, vd, _SC("__classes"));
             if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
                 sq_pushstring(vm, ClassName().c_str(), -1);
                 if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
+                    ClassData<C>** ud;
+                    sq_getuserdata(vm, -1, (SQUserPointer*)&ud, NULL);
                     sq_pop(vm, 3);
+                    vd = VMData::Attach(vm);
+                    if (vd != NULL) {
+                        vd->SetClassData(getClassSlot(), *ud);
+                    }
                     return true;
                 }
                 sq_pop(vm, 1);
@@ -138,25 +326,39 @@ public:
         return false;
     }
 
+    // Returns the class data for the given VM if C was bound in it (otherwise NULL) without searching the registry table for bound types
+    static inline ClassData<C>* findClassData(HSQUIRRELVM vm) {
+        VMData* vd = VMData::Get(vm);
+        if (vd != NULL) {
+            ClassData<C>* cd = static_cast<ClassData<C>*>(vd->GetClassData(getClassSlot()));
+            if (cd != NULL) {
+                return cd;
+            }
+        }
+        return hasClassData(vm) ? getClassData(vm) : NULL;
+    }
+
     static inline AbstractStaticClassData*& BaseClass() {
-        assert(getStaticClassData().Expired() == false); // fails because called before a Sqrat::Class for this type exists
-        return getStaticClassData().Lock()->baseClass;
+        assert(getStaticClassData() != NULL); // fails because called before a Sqrat::Class for this type exists
+        return getStaticClassData()->baseClass;
     }
 
     static inline string& ClassName() {
-        assert(getStaticClassData().Expired() == false); // fails because called before a Sqrat::Class for this type exists
-        return getStaticClassData().Lock()->className;
+        assert(getStaticClassData() != NULL); // fails because called before a Sqrat::Class for this type exists
+        return getStaticClassData()->className;
     }
 
     static inline COPYFUNC& CopyFunc() {
-        assert(getStaticClassData().Expired() == false); // fails because called before a Sqrat::Class for this type exists
-        return getStaticClassData().Lock()->copyFunc;
+        assert(getStaticClassData() != NULL); // fails because called before a Sqrat::Class for this type exists
+        return getStaticClassData()->copyFunc;
     }
 
     static SQInteger DeleteInstance(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = reinterpret_cast<std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >*>(ptr);
-        instance->second->erase(instance->first);
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = reinterpret_cast<std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >*>(ptr);
+        if (instance->second.Get() != NULL) {
+            instance->second->Erase(instance->first);
+        }
         delete instance;
         return 0;
     }
@@ -169,46 +371,66 @@ public:
 
         ClassData<C>* cd = getClassData(vm);
 
-        typename unordered_map<C*, HSQOBJECT>::type::iterator it = cd->instances->find(ptr);
-        if (it != cd->instances->end()) {
-            sq_pushobject(vm, it->second);
-            return;
+        if (cd->instances.Get() != NULL) { // classes bound with Class::TrackInstances(false) get a new instance every time
+            HSQOBJECT* instance = cd->instances->Find(ptr);
+            if (instance != NULL) {
+                sq_pushobject(vm, *instance);
+                return;
+            }
         }
 
         sq_pushobject(vm, cd->classObj);
         sq_createinstance(vm, -1);
         sq_remove(vm, -2);
-        sq_setinstanceup(vm, -1, new std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >(ptr, cd->instances));
+        sq_setinstanceup(vm, -1, new std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >(ptr, cd->instances));
         sq_setreleasehook(vm, -1, &DeleteInstance);
-        sq_getstackobj(vm, -1, &((*cd->instances)[ptr]));
+        if (cd->instances.Get() != NULL) {
+            sq_getstackobj(vm, -1, &((*cd->instances)[ptr]));
+        }
     }
 
     static void PushInstanceCopy(HSQUIRRELVM vm, const C& value) {
-        sq_pushobject(vm, getClassData(vm)->classObj);
+        ClassData<C>* cd = getClassData(vm);
+        sq_pushobject(vm, cd->classObj);
         sq_createinstance(vm, -1);
         sq_remove(vm, -2);
 #ifndef NDEBUG
-        SQRESULT result = CopyFunc()(vm, -1, &value);
+        SQRESULT result = cd->staticData->copyFunc(vm, -1, &value);
         assert(SQ_SUCCEEDED(result)); // fails when trying to copy an object defined as non-copyable
 #else
-        CopyFunc()(vm, -1, &value);
+        cd->staticData->copyFunc(vm, -1, &value);
 #endif
     }
 
+    // Like GetInstance but returns NULL instead of raising an error (for functions bound with FuncUnchecked)
+    static C* GetInstanceQuiet(HSQUIRRELVM vm, SQInteger idx) {
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = NULL;
+        ClassData<C>* cd = findClassData(vm);
+        if (cd == NULL || SQ_FAILED(sq_getinstanceup(vm, idx, (SQUserPointer*)&instance, cd->staticData)) || instance == NULL) {
+            return NULL;
+        }
+        AbstractStaticClassData* actualType = GetNativeClassData(vm, idx);
+        if (cd->staticData != actualType) {
+            return static_cast<C*>(actualType->Cast(instance->first, cd->staticData));
+        }
+        return static_cast<C*>(instance->first);
+    }
+
     static C* GetInstance(HSQUIRRELVM vm, SQInteger idx, bool nullAllowed = false) {
         AbstractStaticClassData* classType = NULL;
-        std::pair<C*, SharedPtr<typename unordered_map<C*, HSQOBJECT>::type> >* instance = NULL;
-        if (hasClassData(vm)) /* type checking only done if the value has type data else it may be enum */
+        std::pair<C*, SharedPtr<PointerMap<C*, HSQOBJECT> > >* instance = NULL;
+        ClassData<C>* cd = findClassData(vm);
+        if (cd != NULL) /* type checking only done if the value has type data else it may be enum */
         {
             if (nullAllowed && sq_gettype(vm, idx) == OT_NULL) {
                 return NULL;
             }
 
-            classType = getStaticClassData().Lock().Get();
+            classType = cd->staticData; // the type tag of C
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
             if (SQ_FAILED(sq_getinstanceup(vm, idx, (SQUserPointer*)&instance, classType))) {
-                SQTHROW(vm, FormatTypeError(vm, idx, ClassName()));
+                SQTHROW(vm, FormatTypeError(vm, idx, classType->className));
                 return NULL;
             }
 
@@ -225,17 +447,7 @@ public:
             SQTHROW(vm, FormatTypeError(vm, idx, _SC("unknown")));
             return NULL;
         }
-        AbstractStaticClassData* actualType;
-        sq_gettypetag(vm, idx, (SQUserPointer*)&actualType);
-        if (actualType == NULL) {
-            SQInteger top = sq_gettop(vm);
-            sq_getclass(vm, idx);
-            while (actualType == NULL) {
-                sq_getbase(vm, -1);
-                sq_gettypetag(vm, -1, (SQUserPointer*)&actualType);
-            }
-            sq_settop(vm, top);
-        }
+        AbstractStaticClassData* actualType = GetNativeClassData(vm, idx);
         if (classType != actualType) {
             return static_cast<C*>(actualType->Cast(instance->first, classType));
         }
@@ -31,6 +31,7 @@
 #include <squirrel.h>
 #include <string.h>
 
+#include "sqratBinding.h"
 #include "sqratObject.h"
 
 namespace Sqrat {
@@ -66,6 +67,10 @@ public:
             sq_addref(vm, &obj);
             sq_pop(vm,1);
         }
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) { // constants are not recorded
+            recorder->RecordUnsupported();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
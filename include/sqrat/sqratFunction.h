@@ -34,6 +34,14 @@
 
 namespace Sqrat {
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// An error raised while calling a Function for one element of a range (see Function::ExecuteBatch)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct BatchError {
+    size_t index;   ///< Position of the element in the range
+    string message; ///< Nice error message
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Represents a function in Squirrel
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -216,6 +224,8 @@ public:
         }
     }
 
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Runs the Function and returns its value as a SharedPtr
     ///
@@ -1252,13 +1262,23 @@ public:
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
     ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    void Execute() {
+    template <class R>
+    bool TryEvaluate(R& out) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1270,36 +1290,46 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 1)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
+#endif
 
-        SQRESULT result = sq_call(vm, 1, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 1, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 1, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 1, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1>
-    void Execute(A1 a1) {
+    template <class R, class A1>
+    bool TryEvaluate(R& out, A1 a1) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1311,42 +1341,50 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 2)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
         PushVar(vm, a1);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 2, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 2, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 2, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 2, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2>
-    void Execute(A1 a1, A2 a2) {
+    template <class R, class A1, class A2>
+    bool TryEvaluate(R& out, A1 a1, A2 a2) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1358,7 +1396,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 3)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1366,37 +1404,45 @@ public:
         PushVar(vm, a2);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 3, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 3, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 3, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 3, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3>
-    void Execute(A1 a1, A2 a2, A3 a3) {
+    template <class R, class A1, class A2, class A3>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1408,7 +1454,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 4)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1417,39 +1463,47 @@ public:
         PushVar(vm, a3);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 4, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 4, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 4, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 4, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
     /// \param a4 Argument 4 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4) {
+    template <class R, class A1, class A2, class A3, class A4>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1461,7 +1515,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 5)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1471,41 +1525,49 @@ public:
         PushVar(vm, a4);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 5, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 5, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 5, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 5, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
     /// \param a4 Argument 4 of the Function
     /// \param a5 Argument 5 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
+    template <class R, class A1, class A2, class A3, class A4, class A5>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1517,7 +1579,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 6)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1528,23 +1590,25 @@ public:
         PushVar(vm, a5);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 6, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 6, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 6, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 6, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
@@ -1552,6 +1616,7 @@ public:
     /// \param a5 Argument 5 of the Function
     /// \param a6 Argument 6 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
@@ -1559,12 +1624,17 @@ public:
     /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1576,7 +1646,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 7)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1588,23 +1658,25 @@ public:
         PushVar(vm, a6);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 7, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 7, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 7, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 7, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
@@ -1613,6 +1685,7 @@ public:
     /// \param a6 Argument 6 of the Function
     /// \param a7 Argument 7 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
@@ -1621,12 +1694,17 @@ public:
     /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1638,7 +1716,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 8)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1651,23 +1729,25 @@ public:
         PushVar(vm, a7);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 8, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 8, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 8, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 8, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
@@ -1677,6 +1757,7 @@ public:
     /// \param a7 Argument 7 of the Function
     /// \param a8 Argument 8 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
@@ -1686,12 +1767,17 @@ public:
     /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1703,7 +1789,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 9)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1717,23 +1803,25 @@ public:
         PushVar(vm, a8);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 9, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 9, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 9, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 9, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
+    /// \param out Receives the return value (left untouched if failed)
     /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     /// \param a3 Argument 3 of the Function
@@ -1744,6 +1832,7 @@ public:
     /// \param a8 Argument 8 of the Function
     /// \param a9 Argument 9 of the Function
     ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
@@ -1754,12 +1843,17 @@ public:
     /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1771,7 +1865,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 10)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1786,51 +1880,59 @@ public:
         PushVar(vm, a9);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 10, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 10, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 10, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 10, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
-    /// \param a1  Argument 1 of the Function
-    /// \param a2  Argument 2 of the Function
-    /// \param a3  Argument 3 of the Function
-    /// \param a4  Argument 4 of the Function
-    /// \param a5  Argument 5 of the Function
-    /// \param a6  Argument 6 of the Function
-    /// \param a7  Argument 7 of the Function
-    /// \param a8  Argument 8 of the Function
-    /// \param a9  Argument 9 of the Function
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
     /// \param a10 Argument 10 of the Function
     ///
-    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1842,7 +1944,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 11)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1858,53 +1960,61 @@ public:
         PushVar(vm, a10);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 11, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 11, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 11, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 11, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
-    /// \param a1  Argument 1 of the Function
-    /// \param a2  Argument 2 of the Function
-    /// \param a3  Argument 3 of the Function
-    /// \param a4  Argument 4 of the Function
-    /// \param a5  Argument 5 of the Function
-    /// \param a6  Argument 6 of the Function
-    /// \param a7  Argument 7 of the Function
-    /// \param a8  Argument 8 of the Function
-    /// \param a9  Argument 9 of the Function
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
     /// \param a10 Argument 10 of the Function
     /// \param a11 Argument 11 of the Function
     ///
-    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -1916,7 +2026,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 12)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -1933,68 +2043,75 @@ public:
         PushVar(vm, a11);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 12, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 12, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 12, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 12, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
-    /// \param a1  Argument 1 of the Function
-    /// \param a2  Argument 2 of the Function
-    /// \param a3  Argument 3 of the Function
-    /// \param a4  Argument 4 of the Function
-    /// \param a5  Argument 5 of the Function
-    /// \param a6  Argument 6 of the Function
-    /// \param a7  Argument 7 of the Function
-    /// \param a8  Argument 8 of the Function
-    /// \param a9  Argument 9 of the Function
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
     /// \param a10 Argument 10 of the Function
     /// \param a11 Argument 11 of the Function
     /// \param a12 Argument 12 of the Function
     ///
-    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
         sq_pushobject(vm, env);
 
-
 #if !defined (SCRAT_NO_ERROR_CHECKING)
         SQUnsignedInteger nparams;
         SQUnsignedInteger nfreevars;
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 13)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -2012,57 +2129,65 @@ public:
         PushVar(vm, a12);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 13, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 13, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 13, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 13, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
-    /// \param a1  Argument 1 of the Function
-    /// \param a2  Argument 2 of the Function
-    /// \param a3  Argument 3 of the Function
-    /// \param a4  Argument 4 of the Function
-    /// \param a5  Argument 5 of the Function
-    /// \param a6  Argument 6 of the Function
-    /// \param a7  Argument 7 of the Function
-    /// \param a8  Argument 8 of the Function
-    /// \param a9  Argument 9 of the Function
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
     /// \param a10 Argument 10 of the Function
     /// \param a11 Argument 11 of the Function
     /// \param a12 Argument 12 of the Function
     /// \param a13 Argument 13 of the Function
     ///
-    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -2074,7 +2199,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 14)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -2093,59 +2218,67 @@ public:
         PushVar(vm, a13);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 14, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 14, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 14, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 14, true, ErrorHandling::IsEnabled());
 #endif
+
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+    /// Runs the Function and reads its return value into caller storage without allocating
     ///
-    /// \param a1  Argument 1 of the Function
-    /// \param a2  Argument 2 of the Function
-    /// \param a3  Argument 3 of the Function
-    /// \param a4  Argument 4 of the Function
-    /// \param a5  Argument 5 of the Function
-    /// \param a6  Argument 6 of the Function
-    /// \param a7  Argument 7 of the Function
-    /// \param a8  Argument 8 of the Function
-    /// \param a9  Argument 9 of the Function
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
     /// \param a10 Argument 10 of the Function
     /// \param a11 Argument 11 of the Function
     /// \param a12 Argument 12 of the Function
     /// \param a13 Argument 13 of the Function
     /// \param a14 Argument 14 of the Function
     ///
-    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
-    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
     /// \tparam A14 Type of argument 14 of the Function (usually doesnt need to be defined explicitly)
     ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
-    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
         SQInteger top = sq_gettop(vm);
 
         sq_pushobject(vm, obj);
@@ -2157,7 +2290,7 @@ public:
         if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 15)) {
             sq_pop(vm, 2);
             SQTHROW(vm, _SC("wrong number of parameters"));
-            return;
+            return false;
         }
 #endif
 
@@ -2177,51 +2310,106 @@ public:
         PushVar(vm, a14);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, 15, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        SQRESULT result = sq_call(vm, 15, true, ErrorHandling::IsEnabled());
 
-        //handle an error: throw the exception
+        //handle an error: pop the stack and throw the exception
         if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
             SQTHROW(vm, LastErrorString(vm));
-            return;
+            return false;
         }
 #else
-        sq_call(vm, 15, false, ErrorHandling::IsEnabled());
-        sq_settop(vm, top);
+        sq_call(vm, 15, true, ErrorHandling::IsEnabled());
 #endif
-    }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
-    ///
-    /// \remarks
-    /// This function MUST have its Error handled if it occurred.
-    ///
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    void operator()() {
-        Execute();
+        return ReadResult(out, top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Runs the Function
     ///
-    /// \param a1 Argument 1 of the Function
-    ///
-    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
-    ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    template <class A1>
-    void operator()(A1 a1) {
-        Execute(a1);
-    }
+    void Execute() {
+        SQInteger top = sq_gettop(vm);
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
-    ///
-    /// \param a1 Argument 1 of the Function
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 1)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+
+        SQRESULT result = sq_call(vm, 1, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 1, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1>
+    void Execute(A1 a1) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 2)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 2, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 2, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
     /// \param a2 Argument 2 of the Function
     ///
     /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
@@ -2232,8 +2420,38 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2>
-    void operator()(A1 a1, A2 a2) {
-        Execute(a1, a2);
+    void Execute(A1 a1, A2 a2) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 3)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 3, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 3, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2252,8 +2470,39 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3>
-    void operator()(A1 a1, A2 a2, A3 a3) {
-        Execute(a1, a2, a3);
+    void Execute(A1 a1, A2 a2, A3 a3) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 4)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 4, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 4, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2274,8 +2523,40 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4) {
-        Execute(a1, a2, a3, a4);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 5)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 5, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 5, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2298,8 +2579,41 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
-        Execute(a1, a2, a3, a4, a5);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 6)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 6, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 6, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2324,8 +2638,42 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
-        Execute(a1, a2, a3, a4, a5, a6);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 7)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 7, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 7, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2352,8 +2700,43 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
-        Execute(a1, a2, a3, a4, a5, a6, a7);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 8)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 8, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 8, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2382,8 +2765,44 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 9)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 9, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 9, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2414,8 +2833,45 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 10)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 10, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 10, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2448,8 +2904,46 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 11)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 11, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 11, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2484,8 +2978,47 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 12)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 12, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 12, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2522,8 +3055,49 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 13)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 13, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 13, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2562,12 +3136,53 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
-    }
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
+        SQInteger top = sq_gettop(vm);
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Runs the Function
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 14)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 14, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 14, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
     ///
     /// \param a1  Argument 1 of the Function
     /// \param a2  Argument 2 of the Function
@@ -2604,69 +3219,2314 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
-    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
-        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+    void Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != 15)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+        PushVar(vm, a14);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, 15, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, 15, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
     }
-};
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template<>
-struct Var<Function> {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void operator()() {
+        Execute();
+    }
 
-    Function value; ///< The actual value of get operations
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1>
+    void operator()(A1 a1) {
+        Execute(a1);
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Attempts to get the value off the stack at idx as a Function
+    /// Runs the Function
     ///
-    /// \param vm  Target VM
-    /// \param idx Index trying to be read
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
     ///
     /// \remarks
-    /// Assumes the Function environment is at index 1.
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2>
+    void operator()(A1 a1, A2 a2) {
+        Execute(a1, a2);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
     ///
     /// \remarks
     /// This function MUST have its Error handled if it occurred.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Var(HSQUIRRELVM vm, SQInteger idx) {
-        HSQOBJECT sqEnv;
-        HSQOBJECT sqValue;
-        sq_getstackobj(vm, 1, &sqEnv);
-        sq_getstackobj(vm, idx, &sqValue);
-        value = Function(vm, sqEnv, sqValue);
-#if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQObjectType value_type = sq_gettype(vm, idx);
-        if (value_type != OT_CLOSURE && value_type != OT_NATIVECLOSURE) {
-            SQTHROW(vm, FormatTypeError(vm, idx, _SC("closure")));
-        }
-#endif
+    template <class A1, class A2, class A3>
+    void operator()(A1 a1, A2 a2, A3 a3) {
+        Execute(a1, a2, a3);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Called by Sqrat::PushVar to put a Function on the stack
+    /// Runs the Function
     ///
-    /// \param vm    Target VM
-    /// \param value Value to push on to the VM's stack
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    static void push(HSQUIRRELVM vm, const Function& value) {
-        sq_pushobject(vm, value.GetFunc());
+    template <class A1, class A2, class A3, class A4>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4) {
+        Execute(a1, a2, a3, a4);
     }
-};
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template<>
-struct Var<Function&> : Var<Function> {Var(HSQUIRRELVM vm, SQInteger idx) : Var<Function>(vm, idx) {}};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
+        Execute(a1, a2, a3, a4, a5);
+    }
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template<>
-struct Var<const Function&> : Var<Function> {Var(HSQUIRRELVM vm, SQInteger idx) : Var<Function>(vm, idx) {}};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+        Execute(a1, a2, a3, a4, a5, a6);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
+        Execute(a1, a2, a3, a4, a5, a6, a7);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1  Argument 1 of the Function
+    /// \param a2  Argument 2 of the Function
+    /// \param a3  Argument 3 of the Function
+    /// \param a4  Argument 4 of the Function
+    /// \param a5  Argument 5 of the Function
+    /// \param a6  Argument 6 of the Function
+    /// \param a7  Argument 7 of the Function
+    /// \param a8  Argument 8 of the Function
+    /// \param a9  Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    ///
+    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1  Argument 1 of the Function
+    /// \param a2  Argument 2 of the Function
+    /// \param a3  Argument 3 of the Function
+    /// \param a4  Argument 4 of the Function
+    /// \param a5  Argument 5 of the Function
+    /// \param a6  Argument 6 of the Function
+    /// \param a7  Argument 7 of the Function
+    /// \param a8  Argument 8 of the Function
+    /// \param a9  Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    ///
+    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1  Argument 1 of the Function
+    /// \param a2  Argument 2 of the Function
+    /// \param a3  Argument 3 of the Function
+    /// \param a4  Argument 4 of the Function
+    /// \param a5  Argument 5 of the Function
+    /// \param a6  Argument 6 of the Function
+    /// \param a7  Argument 7 of the Function
+    /// \param a8  Argument 8 of the Function
+    /// \param a9  Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    ///
+    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1  Argument 1 of the Function
+    /// \param a2  Argument 2 of the Function
+    /// \param a3  Argument 3 of the Function
+    /// \param a4  Argument 4 of the Function
+    /// \param a5  Argument 5 of the Function
+    /// \param a6  Argument 6 of the Function
+    /// \param a7  Argument 7 of the Function
+    /// \param a8  Argument 8 of the Function
+    /// \param a9  Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    ///
+    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1  Argument 1 of the Function
+    /// \param a2  Argument 2 of the Function
+    /// \param a3  Argument 3 of the Function
+    /// \param a4  Argument 4 of the Function
+    /// \param a5  Argument 5 of the Function
+    /// \param a6  Argument 6 of the Function
+    /// \param a7  Argument 7 of the Function
+    /// \param a8  Argument 8 of the Function
+    /// \param a9  Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    /// \param a14 Argument 14 of the Function
+    ///
+    /// \tparam A1  Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2  Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3  Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4  Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5  Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6  Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7  Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8  Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9  Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A14 Type of argument 14 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    void operator()(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
+        Execute(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+    }
+
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and returns its value as a SharedPtr
+    ///
+    /// \param a Arguments of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \return SharedPtr containing the return value (or null if failed)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class... A>
+    SharedPtr<R> Evaluate(A... a) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != sizeof...(A) + 1)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return SharedPtr<R>();
+        }
+#endif
+
+        PushArgs(a...);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, sizeof...(A) + 1, true, ErrorHandling::IsEnabled());
+
+        //handle an error: pop the stack and throw the exception
+        if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
+            SQTHROW(vm, LastErrorString(vm));
+            return SharedPtr<R>();
+        }
+#else
+        sq_call(vm, sizeof...(A) + 1, true, ErrorHandling::IsEnabled());
+#endif
+
+        SharedPtr<R> ret = Var<SharedPtr<R> >(vm, -1).value;
+        sq_settop(vm, top);
+        return ret;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage without allocating
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a   Arguments of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /// \remarks
+    /// Read strings as Sqrat::string, a const SQChar* would point into a string released once the call returns.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class... A>
+    bool TryEvaluate(R& out, A... a) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != sizeof...(A) + 1)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return false;
+        }
+#endif
+
+        PushArgs(a...);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, sizeof...(A) + 1, true, ErrorHandling::IsEnabled());
+
+        //handle an error: pop the stack and throw the exception
+        if (SQ_FAILED(result)) {
+            sq_settop(vm, top);
+            SQTHROW(vm, LastErrorString(vm));
+            return false;
+        }
+#else
+        sq_call(vm, sizeof...(A) + 1, true, ErrorHandling::IsEnabled());
+#endif
+
+        return ReadResult(out, top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a Arguments of the Function
+    ///
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class... A>
+    void Execute(A... a) {
+        SQInteger top = sq_gettop(vm);
+
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -2, &nparams, &nfreevars)) && (nparams != sizeof...(A) + 1)) {
+            sq_pop(vm, 2);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return;
+        }
+#endif
+
+        PushArgs(a...);
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQRESULT result = sq_call(vm, sizeof...(A) + 1, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+
+        //handle an error: throw the exception
+        if (SQ_FAILED(result)) {
+            SQTHROW(vm, LastErrorString(vm));
+            return;
+        }
+#else
+        sq_call(vm, sizeof...(A) + 1, false, ErrorHandling::IsEnabled());
+        sq_settop(vm, top);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a Arguments of the Function
+    ///
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class... A>
+    void operator()(A... a) {
+        Execute(a...);
+    }
+
+private:
+
+    // Pushes the arguments in order (braced initializers are evaluated left to right)
+    template <class... A>
+    void PushArgs(A&... a) {
+        int pushed[] = {0, (PushVar(vm, a), 0)...};
+        (void)pushed;
+    }
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function once for every element of a range, passing the element as the only argument
+    ///
+    /// \param begin  Start of the range
+    /// \param end    End of the range
+    /// \param errors Receives an entry for every element whose call failed (can be NULL)
+    ///
+    /// \tparam Iter Type of the iterators (usually doesnt need to be defined explicitly)
+    ///
+    /// \return Number of elements the Function ran successfully for
+    ///
+    /// \remarks
+    /// The parameter count is checked once and the closure stays on the stack for the whole batch.
+    /// A failing element does not stop the batch and does not leave an Error pending; it is reported in errors instead.
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred (only happens if the Function does not take one argument).
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class Iter>
+    size_t ExecuteBatch(Iter begin, Iter end, std::vector<BatchError>* errors = NULL) {
+        SQInteger top = sq_gettop(vm);
+        if (!BeginBatch()) {
+            return 0;
+        }
+        SQInteger base = sq_gettop(vm); // the closure stays on the stack for the whole batch
+
+        size_t succeeded = 0;
+        for (size_t index = 0; begin != end; ++begin, ++index) {
+            sq_pushobject(vm, env);
+            PushVar(vm, *begin);
+            // checked in every build: after a failed or suspended call the stack is not as expected
+            if (SQ_FAILED(sq_call(vm, 2, false, ErrorHandling::IsEnabled()))) {
+                AddBatchError(errors, index, LastErrorString(vm));
+                sq_settop(vm, base);
+                continue;
+            }
+            sq_settop(vm, base);
+            ++succeeded;
+        }
+
+        sq_settop(vm, top);
+        return succeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function once for every element of a range and stores the return values in a caller buffer
+    ///
+    /// \param begin  Start of the range
+    /// \param end    End of the range
+    /// \param out    Start of the buffer receiving one return value per element (failed elements are left untouched)
+    /// \param errors Receives an entry for every element whose call failed (can be NULL)
+    ///
+    /// \tparam R       Type of return value (elements returning another type fail)
+    /// \tparam InIter  Type of the iterators of the range (usually doesnt need to be defined explicitly)
+    /// \tparam OutIter Type of the iterator of the buffer (usually doesnt need to be defined explicitly)
+    ///
+    /// \return Number of elements whose return value was stored
+    ///
+    /// \remarks
+    /// The parameter count is checked once and the closure stays on the stack for the whole batch.
+    /// A failing element does not stop the batch and does not leave an Error pending; it is reported in errors instead.
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred (only happens if the Function does not take one argument).
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class InIter, class OutIter>
+    size_t EvaluateBatch(InIter begin, InIter end, OutIter out, std::vector<BatchError>* errors = NULL) {
+        SQInteger top = sq_gettop(vm);
+        if (!BeginBatch()) {
+            return 0;
+        }
+        SQInteger base = sq_gettop(vm); // the closure stays on the stack for the whole batch
+
+        size_t succeeded = 0;
+        for (size_t index = 0; begin != end; ++begin, ++out, ++index) {
+            sq_pushobject(vm, env);
+            PushVar(vm, *begin);
+            // checked in every build: after a failed or suspended call the stack is not as expected
+            if (SQ_FAILED(sq_call(vm, 2, true, ErrorHandling::IsEnabled()))) {
+                AddBatchError(errors, index, LastErrorString(vm));
+                sq_settop(vm, base);
+                continue;
+            }
+            SQTRY()
+            Var<R> ret(vm, -1);
+            SQCATCH_NOEXCEPT(vm) {
+                AddBatchError(errors, index, SQWHAT_NOEXCEPT(vm)); // Error::Message also clears the error
+                sq_settop(vm, base);
+                continue;
+            }
+            *out = ret.value;
+            SQCATCH(vm) {
+                AddBatchError(errors, index, SQWHAT(vm));
+                sq_settop(vm, base);
+                continue;
+            }
+            sq_settop(vm, base);
+            ++succeeded;
+        }
+
+        sq_settop(vm, top);
+        return succeeded;
+    }
+
+private:
+
+    // Pushes the closure for a batch after checking that it takes one argument
+    bool BeginBatch() {
+        sq_pushobject(vm, obj);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -1, &nparams, &nfreevars)) && (nparams != 2)) {
+            sq_pop(vm, 1);
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return false;
+        }
+#endif
+        sq_reservestack(vm, 3); // environment, element and return value
+        return true;
+    }
+
+    static void AddBatchError(std::vector<BatchError>* errors, size_t index, const string& message) {
+        if (errors != NULL) {
+            BatchError err;
+            err.index = index;
+            err.message = message;
+            errors->push_back(err);
+        }
+    }
+
+    // Reads the return value on top of the stack into out and restores the stack to top (see TryEvaluate)
+    template <class R>
+    bool ReadResult(R& out, SQInteger top) {
+        SQTRY()
+        Var<R> ret(vm, -1);
+        SQCATCH_NOEXCEPT(vm) {
+            sq_settop(vm, top);
+            return false;
+        }
+        out = ret.value;
+        sq_settop(vm, top);
+        return true;
+        SQCATCH(vm) {
+#if defined (SCRAT_USE_EXCEPTIONS)
+            SQUNUSED(e); // avoid "unreferenced local variable" warning
+#endif
+            sq_settop(vm, top);
+            SQRETHROW(vm);
+        }
+        return false; // avoid "not all control paths return a value" warning
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<>
+struct Var<Function> {
+
+    Function value; ///< The actual value of get operations
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Attempts to get the value off the stack at idx as a Function
+    ///
+    /// \param vm  Target VM
+    /// \param idx Index trying to be read
+    ///
+    /// \remarks
+    /// Assumes the Function environment is at index 1.
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Var(HSQUIRRELVM vm, SQInteger idx) {
+        HSQOBJECT sqEnv;
+        HSQOBJECT sqValue;
+        sq_getstackobj(vm, 1, &sqEnv);
+        sq_getstackobj(vm, idx, &sqValue);
+        value = Function(vm, sqEnv, sqValue);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        SQObjectType value_type = sq_gettype(vm, idx);
+        if (value_type != OT_CLOSURE && value_type != OT_NATIVECLOSURE) {
+            SQTHROW(vm, FormatTypeError(vm, idx, _SC("closure")));
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat::PushVar to put a Function on the stack
+    ///
+    /// \param vm    Target VM
+    /// \param value Value to push on to the VM's stack
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void push(HSQUIRRELVM vm, const Function& value) {
+        sq_pushobject(vm, value.GetFunc());
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<>
+struct Var<Function&> : Var<Function> {Var(HSQUIRRELVM vm, SQInteger idx) : Var<Function>(vm, idx) {}};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Used to get and push Function instances to and from the stack as references (functions are always references in Squirrel)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<>
+struct Var<const Function&> : Var<Function> {Var(HSQUIRRELVM vm, SQInteger idx) : Var<Function>(vm, idx) {}};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// A Function prepared for being called many times from C++
+///
+/// \remarks
+/// The parameter count of the function is read once when the PreparedFunction is made instead of on every call.
+/// Use it for callbacks run every frame or every request; use Function for one-off calls.
+/// The script it runs may call the same PreparedFunction again.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class PreparedFunction {
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Default constructor (null)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    PreparedFunction() : vm(NULL), paramCount(-1) {
+        sq_resetobject(&env);
+        sq_resetobject(&obj);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Prepares a Function
+    ///
+    /// \param sf Function to prepare (must not be null)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    PreparedFunction(const Function& sf) : func(sf), vm(sf.GetVM()), env(sf.GetEnv()), obj(sf.GetFunc()), paramCount(-1) {
+        sq_pushobject(vm, obj);
+        SQUnsignedInteger nparams;
+        SQUnsignedInteger nfreevars;
+        if (SQ_SUCCEEDED(sq_getclosureinfo(vm, -1, &nparams, &nfreevars))) {
+            paramCount = static_cast<SQInteger>(nparams);
+            sq_reservestack(vm, paramCount + 2); // room for the closure, its parameters and its return value
+        }
+        sq_pop(vm, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Checks whether the PreparedFunction is null
+    ///
+    /// \return True if the PreparedFunction currently has a null value, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsNull() const {
+        return sq_isnull(obj);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the Function that was prepared
+    ///
+    /// \return The Function
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const Function& GetFunction() const {
+        return func;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the number of parameters of the function including the environment
+    ///
+    /// \return Parameter count (or -1 if the function does not report one, like native closures in some Squirrel versions)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SQInteger GetParamCount() const {
+        return paramCount;
+    }
+
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R>
+    bool TryEvaluate(R& out) {
+        SQInteger top = Begin(1);
+        if (top < 0) {
+            return false;
+        }
+        return Call(top, 1, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool Execute() {
+        SQInteger top = Begin(1);
+        if (top < 0) {
+            return false;
+        }
+        return Call(top, 1, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1>
+    bool TryEvaluate(R& out, A1 a1) {
+        SQInteger top = Begin(2);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        return Call(top, 2, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1>
+    bool Execute(A1 a1) {
+        SQInteger top = Begin(2);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        return Call(top, 2, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2>
+    bool TryEvaluate(R& out, A1 a1, A2 a2) {
+        SQInteger top = Begin(3);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        return Call(top, 3, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2>
+    bool Execute(A1 a1, A2 a2) {
+        SQInteger top = Begin(3);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        return Call(top, 3, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3) {
+        SQInteger top = Begin(4);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        return Call(top, 4, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3>
+    bool Execute(A1 a1, A2 a2, A3 a3) {
+        SQInteger top = Begin(4);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        return Call(top, 4, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4) {
+        SQInteger top = Begin(5);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        return Call(top, 5, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4) {
+        SQInteger top = Begin(5);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        return Call(top, 5, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
+        SQInteger top = Begin(6);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        return Call(top, 6, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) {
+        SQInteger top = Begin(6);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        return Call(top, 6, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+        SQInteger top = Begin(7);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        return Call(top, 7, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) {
+        SQInteger top = Begin(7);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        return Call(top, 7, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
+        SQInteger top = Begin(8);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        return Call(top, 8, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) {
+        SQInteger top = Begin(8);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        return Call(top, 8, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
+        SQInteger top = Begin(9);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        return Call(top, 9, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) {
+        SQInteger top = Begin(9);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        return Call(top, 9, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
+        SQInteger top = Begin(10);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        return Call(top, 10, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) {
+        SQInteger top = Begin(10);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        return Call(top, 10, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
+        SQInteger top = Begin(11);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        return Call(top, 11, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) {
+        SQInteger top = Begin(11);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        return Call(top, 11, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
+        SQInteger top = Begin(12);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        return Call(top, 12, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) {
+        SQInteger top = Begin(12);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        return Call(top, 12, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
+        SQInteger top = Begin(13);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        return Call(top, 13, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) {
+        SQInteger top = Begin(13);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        return Call(top, 13, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
+        SQInteger top = Begin(14);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+        return Call(top, 14, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) {
+        SQInteger top = Begin(14);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+        return Call(top, 14, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    /// \param a14 Argument 14 of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A14 Type of argument 14 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    bool TryEvaluate(R& out, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
+        SQInteger top = Begin(15);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+        PushVar(vm, a14);
+        return Call(top, 15, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a1 Argument 1 of the Function
+    /// \param a2 Argument 2 of the Function
+    /// \param a3 Argument 3 of the Function
+    /// \param a4 Argument 4 of the Function
+    /// \param a5 Argument 5 of the Function
+    /// \param a6 Argument 6 of the Function
+    /// \param a7 Argument 7 of the Function
+    /// \param a8 Argument 8 of the Function
+    /// \param a9 Argument 9 of the Function
+    /// \param a10 Argument 10 of the Function
+    /// \param a11 Argument 11 of the Function
+    /// \param a12 Argument 12 of the Function
+    /// \param a13 Argument 13 of the Function
+    /// \param a14 Argument 14 of the Function
+    ///
+    /// \tparam A1 Type of argument 1 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A2 Type of argument 2 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A3 Type of argument 3 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A4 Type of argument 4 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A5 Type of argument 5 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A6 Type of argument 6 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A7 Type of argument 7 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A8 Type of argument 8 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A9 Type of argument 9 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A10 Type of argument 10 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A11 Type of argument 11 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A12 Type of argument 12 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A13 Type of argument 13 of the Function (usually doesnt need to be defined explicitly)
+    /// \tparam A14 Type of argument 14 of the Function (usually doesnt need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    bool Execute(A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) {
+        SQInteger top = Begin(15);
+        if (top < 0) {
+            return false;
+        }
+        PushVar(vm, a1);
+        PushVar(vm, a2);
+        PushVar(vm, a3);
+        PushVar(vm, a4);
+        PushVar(vm, a5);
+        PushVar(vm, a6);
+        PushVar(vm, a7);
+        PushVar(vm, a8);
+        PushVar(vm, a9);
+        PushVar(vm, a10);
+        PushVar(vm, a11);
+        PushVar(vm, a12);
+        PushVar(vm, a13);
+        PushVar(vm, a14);
+        return Call(top, 15, false);
+    }
+
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function and reads its return value into caller storage (see Function::TryEvaluate)
+    ///
+    /// \param out Receives the return value (left untouched if failed)
+    /// \param a   Arguments of the Function
+    ///
+    /// \tparam R Type of return value (fails if return value is not of this type)
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \return True if the Function ran and its return value was read, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class R, class... A>
+    bool TryEvaluate(R& out, A... a) {
+        SQInteger top = Begin(sizeof...(A) + 1);
+        if (top < 0) {
+            return false;
+        }
+        int pushed[] = {0, (PushVar(vm, a), 0)...};
+        (void)pushed;
+        return Call(top, sizeof...(A) + 1, true) && ReadResult(top, out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs the Function
+    ///
+    /// \param a Arguments of the Function
+    ///
+    /// \tparam A Types of the arguments of the Function (usually dont need to be defined explicitly)
+    ///
+    /// \return True if the Function ran, otherwise false
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <class... A>
+    bool Execute(A... a) {
+        SQInteger top = Begin(sizeof...(A) + 1);
+        if (top < 0) {
+            return false;
+        }
+        int pushed[] = {0, (PushVar(vm, a), 0)...};
+        (void)pushed;
+        return Call(top, sizeof...(A) + 1, false);
+    }
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+private:
+
+    // Checks the cached parameter count and pushes the closure and its environment
+    // Returns the top of the stack before the call (or -1 if failed); it is kept by the caller rather than in a member so
+    // that the function can be called again from inside the script it runs
+    SQInteger Begin(SQInteger nargs) {
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (paramCount >= 0 && paramCount != nargs) {
+            SQTHROW(vm, _SC("wrong number of parameters"));
+            return -1;
+        }
+#else
+        SQUNUSED(nargs);
+#endif
+        SQInteger top = sq_gettop(vm);
+        sq_pushobject(vm, obj);
+        sq_pushobject(vm, env);
+        return top;
+    }
+
+    // Calls the closure pushed by Begin (the stack is restored to top here, or by ReadResult once the return value is read)
+    bool Call(SQInteger top, SQInteger nargs, bool retval) {
+        // the result is checked even without error checking: a failed or suspended call leaves no return value
+        if (SQ_FAILED(sq_call(vm, nargs, retval, ErrorHandling::IsEnabled()))) {
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+            string msg = LastErrorString(vm);
+            sq_settop(vm, top);
+            SQTHROW(vm, msg);
+#else
+            sq_settop(vm, top);
+#endif
+            return false;
+        }
+        if (!retval) {
+            sq_settop(vm, top);
+        }
+        return true;
+    }
+
+    // Reads the return value on top of the stack into out and restores the stack
+    template <class R>
+    bool ReadResult(SQInteger top, R& out) {
+        SQTRY()
+        Var<R> ret(vm, -1);
+        SQCATCH_NOEXCEPT(vm) {
+            sq_settop(vm, top);
+            return false;
+        }
+        out = ret.value;
+        sq_settop(vm, top);
+        return true;
+        SQCATCH(vm) {
+#if defined (SCRAT_USE_EXCEPTIONS)
+            SQUNUSED(e); // avoid "unreferenced local variable" warning
+#endif
+            sq_settop(vm, top);
+            SQRETHROW(vm);
+        }
+        return false; // avoid "not all control paths return a value" warning
+    }
+
+    Function    func; // keeps the closure and its environment referenced
+    HSQUIRRELVM vm;
+    HSQOBJECT   env;
+    HSQOBJECT   obj;
+    SQInteger   paramCount;
+};
 
 }
 
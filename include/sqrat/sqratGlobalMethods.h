@@ -36,6 +36,8 @@ namespace Sqrat {
 
 /// @cond DEV
 
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
 //
 // Squirrel Global Functions
 //
@@ -2375,6 +2377,172 @@ SQFUNCTION SqMemberGlobalFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8,
     return &SqGlobal<R&>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, 1, false>;
 }
 
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+//
+// Squirrel Global Functions (variadic, one instantiation per signature and no limit on the number of arguments)
+//
+template <class R>
+class SqGlobal {
+public:
+
+    template <SQInteger startIdx, bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, overloaded, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <SQInteger startIdx, bool overloaded, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != startIdx + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+
+        typedef R (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+
+        SQTRY()
+        SqArgs<startIdx, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        R ret = (*method)(
+                    SqArgValue<startIdx + static_cast<SQInteger>(I), A>(args)...
+                );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class R>
+class SqGlobal<R&> {
+public:
+
+    template <SQInteger startIdx, bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, overloaded, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <SQInteger startIdx, bool overloaded, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != startIdx + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+
+        typedef R& (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+
+        SQTRY()
+        SqArgs<startIdx, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        R& ret = (*method)(
+                    SqArgValue<startIdx + static_cast<SQInteger>(I), A>(args)...
+                );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <>
+class SqGlobal<void> {
+public:
+
+    template <SQInteger startIdx, bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, overloaded, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <SQInteger startIdx, bool overloaded, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != startIdx + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+
+        typedef void (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+
+        SQTRY()
+        SqArgs<startIdx, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        (*method)(
+            SqArgValue<startIdx + static_cast<SQInteger>(I), A>(args)...
+        );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Global Function Resolvers
+//
+
+template <class R, class... A>
+SQFUNCTION SqGlobalFunc(R (* /*method*/)(A...)) {
+    return &SqGlobal<R>::template Func<2, false, A...>;
+}
+
+
+//
+// Member Global Function Resolvers
+//
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class... A>
+SQFUNCTION SqMemberGlobalFunc(R (* /*method*/)(A1, A...)) {
+    return &SqGlobal<R>::template Func<1, false, A1, A...>;
+}
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
 /// @endcond
 
 }
@@ -30,12 +30,15 @@
 #define _SCRAT_MEMBER_METHODS_H_
 
 #include <squirrel.h>
+#include <string.h>
 #include "sqratTypes.h"
 
 namespace Sqrat {
 
 /// @cond DEV
 
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
 //
 // Squirrel Global Functions
 //
@@ -5424,6 +5427,224 @@ inline SQFUNCTION SqMemberFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7,
 }
 
 
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+//
+// Squirrel Member Functions (variadic, one instantiation per signature and no limit on the number of arguments)
+//
+
+template <class C, class R>
+class SqMember {
+public:
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A...);
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A...) const;
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <bool overloaded, class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != 2 + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        M method = *methodPtr;
+
+        C* ptr;
+        SQTRY()
+        ptr = Var<C*>(vm, 1).value;
+        SQCATCH_NOEXCEPT(vm) {
+            SQCLEAR(vm); // clear the previous error
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        SQCATCH(vm) {
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+
+        SQTRY()
+        SqArgs<2, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        R ret = (ptr->*method)(
+                    SqArgValue<2 + static_cast<SQInteger>(I), A>(args)...
+                );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class C, class R>
+class SqMember<C, R&> {
+public:
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A...);
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A...) const;
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <bool overloaded, class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != 2 + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        M method = *methodPtr;
+
+        C* ptr;
+        SQTRY()
+        ptr = Var<C*>(vm, 1).value;
+        SQCATCH_NOEXCEPT(vm) {
+            SQCLEAR(vm); // clear the previous error
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        SQCATCH(vm) {
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+
+        SQTRY()
+        SqArgs<2, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        R& ret = (ptr->*method)(
+                    SqArgValue<2 + static_cast<SQInteger>(I), A>(args)...
+                );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <class C>
+class SqMember<C, void> {
+public:
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A...);
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <bool overloaded /*= false*/, class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A...) const;
+        return Call<overloaded, M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <bool overloaded, class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (!SQRAT_CONST_CONDITION(overloaded) && sq_gettop(vm) != 2 + static_cast<SQInteger>(sizeof...(A))) {
+            return sq_throwerror(vm, _SC("wrong number of parameters"));
+        }
+#endif
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        M method = *methodPtr;
+
+        C* ptr;
+        SQTRY()
+        ptr = Var<C*>(vm, 1).value;
+        SQCATCH_NOEXCEPT(vm) {
+            SQCLEAR(vm); // clear the previous error
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        SQCATCH(vm) {
+            assert(0); // may fail because C is not a type bound in the VM
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+
+        SQTRY()
+        SqArgs<2, index_sequence<I...>, A...> args(vm);
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        (ptr->*method)(
+            SqArgValue<2 + static_cast<SQInteger>(I), A>(args)...
+        );
+        SQCATCH_NOEXCEPT(vm) {
+            return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+        }
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Member Function Resolvers
+//
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberFunc(R (C::* /*method*/)(A...)) {
+    return &SqMember<C, R>::template Func<false, A...>;
+}
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberFunc(R (C::* /*method*/)(A...) const) {
+    return &SqMember<C, R>::template FuncC<false, A...>;
+}
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
 //
 // Variable Get
 //
@@ -5451,6 +5672,25 @@ inline SQInteger sqDefaultGet(HSQUIRRELVM vm) {
     return 1;
 }
 
+// Getter of a variable whose member pointer is a template argument (no member pointer has to be fetched at runtime)
+template <class C, class V, V C::* member>
+inline SQInteger sqFieldGet(HSQUIRRELVM vm) {
+    C* ptr;
+    SQTRY()
+    ptr = Var<C*>(vm, 1).value;
+    SQCATCH_NOEXCEPT(vm) {
+        SQCLEAR(vm); // clear the previous error
+        return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+    }
+    SQCATCH(vm) {
+        return sq_throwerror(vm, SQWHAT(vm));
+    }
+
+    PushVarR(vm, ptr->*member);
+
+    return 1;
+}
+
 template <class C, class V>
 inline SQInteger sqStaticGet(HSQUIRRELVM vm) {
     typedef V *M;
@@ -5463,6 +5703,28 @@ inline SQInteger sqStaticGet(HSQUIRRELVM vm) {
     return 1;
 }
 
+//
+// Variable Accessors
+//
+
+// The get and set tables hold an accessor descriptor per variable: a userdata containing the bound member pointer
+// (or function) followed by the native function that accesses it, which sqVarGet and sqVarSet call in place
+inline void sqNewAccessor(HSQUIRRELVM vm, const void* var, size_t varSize, SQFUNCTION func) {
+    char* data = static_cast<char*>(sq_newuserdata(vm, static_cast<SQUnsignedInteger>(varSize + sizeof(SQFUNCTION))));
+    if (varSize > 0) {
+        memcpy(data, var, varSize); // first so the accessor finds it where it would find a free variable
+    }
+    memcpy(data + varSize, &func, sizeof(SQFUNCTION));
+}
+
+inline SQFUNCTION sqAccessorFunc(HSQUIRRELVM vm, SQInteger idx) {
+    SQUserPointer data = NULL;
+    sq_getuserdata(vm, idx, &data, NULL);
+    SQFUNCTION func;
+    memcpy(&func, static_cast<char*>(data) + sq_getsize(vm, idx) - sizeof(SQFUNCTION), sizeof(SQFUNCTION));
+    return func;
+}
+
 inline SQInteger sqVarGet(HSQUIRRELVM vm) {
     // Find the get method in the get table
     sq_push(vm, 2);
@@ -5479,7 +5741,12 @@ inline SQInteger sqVarGet(HSQUIRRELVM vm) {
     sq_rawget(vm, -2);
 #endif
 
-    // push 'this'
+    // Call the accessor in place ('this' is at 1 and the descriptor is on top where its free variable would be)
+    if (sq_gettype(vm, -1) == OT_USERDATA) {
+        return sqAccessorFunc(vm, -1)(vm);
+    }
+
+    // Otherwise it is a closure that was put in the table by hand so push 'this'
     sq_push(vm, 1);
 
     // Call the getter
@@ -5534,6 +5801,36 @@ inline SQInteger sqDefaultSet(HSQUIRRELVM vm) {
     return 0;
 }
 
+// Setter of a variable whose member pointer is a template argument (no member pointer has to be fetched at runtime)
+template <class C, class V, V C::* member>
+inline SQInteger sqFieldSet(HSQUIRRELVM vm) {
+    C* ptr;
+    SQTRY()
+    ptr = Var<C*>(vm, 1).value;
+    SQCATCH_NOEXCEPT(vm) {
+        SQCLEAR(vm); // clear the previous error
+        return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+    }
+    SQCATCH(vm) {
+        return sq_throwerror(vm, SQWHAT(vm));
+    }
+
+    SQTRY()
+    if (is_pointer<V>::value || is_reference<V>::value) {
+        ptr->*member = Var<V>(vm, 2).value;
+    } else {
+        ptr->*member = Var<const V&>(vm, 2).value;
+    }
+    SQCATCH_NOEXCEPT(vm) {
+        return sq_throwerror(vm, SQWHAT_NOEXCEPT(vm));
+    }
+    SQCATCH(vm) {
+        return sq_throwerror(vm, SQWHAT(vm));
+    }
+
+    return 0;
+}
+
 template <class C, class V>
 inline SQInteger sqStaticSet(HSQUIRRELVM vm) {
     typedef V *M;
@@ -5573,7 +5870,15 @@ inline SQInteger sqVarSet(HSQUIRRELVM vm) {
     sq_rawget(vm, -2);
 #endif
 
-    // push 'this'
+    // Call the accessor in place once the key is out of the way (setters expect the new value at 2)
+    if (sq_gettype(vm, -1) == OT_USERDATA) {
+        SQFUNCTION func = sqAccessorFunc(vm, -1);
+        sq_remove(vm, 2);
+        SQInteger result = func(vm);
+        return SQ_FAILED(result) ? result : 0;
+    }
+
+    // Otherwise it is a closure that was put in the table by hand so push 'this'
     sq_push(vm, 1);
     sq_push(vm, 3);
 
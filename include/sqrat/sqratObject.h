@@ -225,6 +225,38 @@ public:
         sq_pushobject(vm, GetObject());
         sq_pushstring(vm, slot, -1);
 
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if(SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            return Object(vm); // Return a NULL object
+        } else {
+            sq_getstackobj(vm, -1, &slotObj);
+            Object ret(slotObj, vm); // must addref before the pop!
+            sq_pop(vm, 2);
+            return ret;
+        }
+#else
+        sq_get(vm, -2);
+        sq_getstackobj(vm, -1, &slotObj);
+        Object ret(slotObj, vm); // must addref before the pop!
+        sq_pop(vm, 2);
+        return ret;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Attempts to get the value of a slot from the object
+    ///
+    /// \param slot Interned name of the slot
+    ///
+    /// \return An Object representing the value of the slot (can be a null object if nothing was found)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Object GetSlot(const Key& slot) const {
+        HSQOBJECT slotObj;
+        sq_pushobject(vm, GetObject());
+        slot.Push(vm);
+
 #if !defined (SCRAT_NO_ERROR_CHECKING)
         if(SQ_FAILED(sq_get(vm, -2))) {
             sq_pop(vm, 1);
@@ -295,6 +327,25 @@ public:
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Checks if the object has a slot with a specified key
+    ///
+    /// \param key Interned name of the key
+    ///
+    /// \return True if the Object has a value associated with key, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool HasKey(const Key& key) const {
+        sq_pushobject(vm, GetObject());
+        key.Push(vm);
+        if (SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            return false;
+        }
+        sq_pop(vm, 2);
+        return true;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Checks if the object has a slot with a specified index
     ///
@@ -471,24 +522,9 @@ protected:
 
 
     // Bind a function and it's associated Squirrel closure to the object
-    inline void BindOverload(const SQChar* name, void* method, size_t methodSize, SQFUNCTION func, SQFUNCTION overload, int argCount, bool staticVar = false) {
-        string overloadName = SqOverloadName::Get(name, argCount);
-
+    inline void BindOverload(const SQChar* name, void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func, SQFUNCTION overload, int argCount, bool staticVar = false) {
         sq_pushobject(vm, GetObject());
-
-        // Bind overload handler
-        sq_pushstring(vm, name, -1);
-        sq_pushstring(vm, name, -1); // function name is passed as a free variable
-        sq_newclosure(vm, overload, 1);
-        sq_newslot(vm, -3, staticVar);
-
-        // Bind overloaded function
-        sq_pushstring(vm, overloadName.c_str(), -1);
-        SQUserPointer methodPtr = sq_newuserdata(vm, static_cast<SQUnsignedInteger>(methodSize));
-        memcpy(methodPtr, method, methodSize);
-        sq_newclosure(vm, func, 1);
-        sq_newslot(vm, -3, staticVar);
-
+        SqBindOverload(vm, name, method, methodSize, match, func, overload, argCount, staticVar);
         sq_pop(vm,1); // pop table
     }
 
@@ -30,7 +30,6 @@
 
 #include <squirrel.h>
 #include <sqstdaux.h>
-#include <sstream>
 #include "sqratTypes.h"
 #include "sqratUtil.h"
 #include "sqratGlobalMethods.h"
@@ -47,107 +46,251 @@ namespace Sqrat {
 class SqOverloadName {
 public:
 
-    static string Get(const SQChar* name, int args) {
-        std::basic_stringstream<SQChar> overloadName;
-        overloadName << _SC("__overload_") << name << args;
-
-        return overloadName.str();
+    static string Get(const SQChar* name) {
+        return string(_SC("__overload_")) + name;
     }
 };
 
 
 //
-// Squirrel Overload Functions
+// Overload descriptors
 //
 
-template <class R>
-class SqOverload {
-public:
+typedef SQInteger (*OVERLOADMATCHFUNC)(HSQUIRRELVM vm);
 
-    static SQInteger Func(HSQUIRRELVM vm) {
-        // Get the arg count
-        int argCount = sq_gettop(vm) - 2;
-
-        const SQChar* funcName;
-        sq_getstring(vm, -1, &funcName); // get the function name (free variable)
+// Number of argument signatures remembered by each set of overloads that take the same number of arguments (a power of 2)
+#if !defined (SCRAT_OVERLOAD_CACHE_SIZE)
+#define SCRAT_OVERLOAD_CACHE_SIZE 8
+#endif
 
-        string overloadName = SqOverloadName::Get(funcName, argCount);
+// Pushes a descriptor of an overload: its method, the function that scores its argument types and the function that calls it
+inline void SqNewOverload(HSQUIRRELVM vm, const void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func) {
+    char* data = static_cast<char*>(sq_newuserdata(vm, static_cast<SQUnsignedInteger>(methodSize + sizeof(OVERLOADMATCHFUNC) + sizeof(SQFUNCTION))));
+    if (methodSize > 0) {
+        memcpy(data, method, methodSize); // first so the function finds it where it would find a free variable
+    }
+    memcpy(data + methodSize, &match, sizeof(OVERLOADMATCHFUNC));
+    memcpy(data + methodSize + sizeof(OVERLOADMATCHFUNC), &func, sizeof(SQFUNCTION)); // last so sqAccessorFunc finds it
+}
 
-        sq_pushstring(vm, overloadName.c_str(), -1);
+inline OVERLOADMATCHFUNC SqOverloadMatchOf(HSQUIRRELVM vm, SQInteger idx) {
+    SQUserPointer data = NULL;
+    sq_getuserdata(vm, idx, &data, NULL);
+    OVERLOADMATCHFUNC match;
+    memcpy(&match, static_cast<char*>(data) + sq_getsize(vm, idx) - sizeof(SQFUNCTION) - sizeof(OVERLOADMATCHFUNC), sizeof(OVERLOADMATCHFUNC));
+    return match;
+}
 
-#if !defined (SCRAT_NO_ERROR_CHECKING)
-        if (SQ_FAILED(sq_get(vm, 1))) { // Lookup the proper overload
-            return sq_throwerror(vm, _SC("wrong number of parameters"));
+// Identifies the type of the value at idx: for instances the native class they are (or extend, for Squirrel classes that
+// extend one), else its Squirrel type. Instances of Squirrel classes that extend no native class give 0 and are resolved
+// without the cache
+inline size_t SqOverloadArgKey(HSQUIRRELVM vm, SQInteger idx) {
+    SQObjectType type = sq_gettype(vm, idx);
+    if (type == OT_INSTANCE) {
+        return reinterpret_cast<size_t>(GetNativeClassData(vm, idx));
+    }
+    return (static_cast<size_t>(type) << 1) | 1; // odd so that it never equals a type tag
+}
+
+// Pushes the overload whose argument types best match the arguments of the call. The set of overloads on top of the stack
+// holds a cache of the overloads chosen for the last argument signatures at index 0, then the overloads themselves
+inline bool SqPushBestOverload(HSQUIRRELVM vm, SQInteger argCount) {
+    SQInteger set = sq_gettop(vm);
+
+    size_t* cache;
+    sq_pushinteger(vm, 0);
+    sq_rawget(vm, set);
+    sq_getuserdata(vm, -1, (SQUserPointer*)&cache, NULL);
+    sq_pop(vm, 1);
+
+    // Look for the argument signature in the cache (the keys are computed once for the lookup and the store)
+    const SQInteger maxCachedArgs = 16;
+    size_t keys[maxCachedArgs];
+    bool cacheable = argCount <= maxCachedArgs;
+    size_t hash = 0;
+    for (SQInteger i = 0; cacheable && i < argCount; ++i) {
+        keys[i] = SqOverloadArgKey(vm, i + 2);
+        cacheable = keys[i] != 0;
+        hash = (hash ^ keys[i] ^ (keys[i] >> 4)) * 16777619u;
+    }
+    size_t* entry = cache + (hash & (SCRAT_OVERLOAD_CACHE_SIZE - 1)) * (argCount + 1); // the key of each argument, then the overload
+    SQInteger best = 0;
+    if (cacheable && entry[argCount] != 0) {
+        best = static_cast<SQInteger>(entry[argCount]);
+        for (SQInteger i = 0; i < argCount; ++i) {
+            if (entry[i] != keys[i]) {
+                best = 0;
+                break;
+            }
         }
-#else
-        sq_get(vm, 1);
-#endif
+    }
 
-        // Push the args again
-        for (int i = 1; i <= argCount + 1; ++i) {
-            sq_push(vm, i);
+    // Otherwise score every overload, the first one bound wins a tie
+    if (best == 0) {
+        SQInteger bestScore = 0;
+        SQInteger count = sq_getsize(vm, set);
+        for (SQInteger i = 1; i < count; ++i) {
+            sq_pushinteger(vm, i);
+            sq_rawget(vm, set);
+            SQInteger score = SqOverloadMatchOf(vm, -1)(vm);
+            sq_pop(vm, 1);
+            if (score > bestScore) {
+                best = i;
+                bestScore = score;
+            }
         }
-
-#if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, argCount + 1, true, ErrorHandling::IsEnabled());
-        if (SQ_FAILED(result)) {
-            return sq_throwerror(vm, LastErrorString(vm).c_str());
+        if (best == 0) {
+            return false;
+        }
+        if (cacheable) {
+            for (SQInteger i = 0; i < argCount; ++i) {
+                entry[i] = keys[i];
+            }
+            entry[argCount] = static_cast<size_t>(best);
         }
-#else
-        sq_call(vm, argCount + 1, true, ErrorHandling::IsEnabled());
-#endif
-
-        return 1;
     }
-};
+
+    sq_pushinteger(vm, best);
+    sq_rawget(vm, set);
+    return true;
+}
 
 
 //
-// void return specialization
+// Squirrel Overload Functions
 //
 
-template <>
-class SqOverload<void> {
+// The overload handler's free variable is an array indexed by argument count. Each element is the descriptor of the only
+// overload taking that many arguments, an array holding the overloads that differ by argument types, or null
+template <class R>
+class SqOverload {
 public:
 
     static SQInteger Func(HSQUIRRELVM vm) {
         // Get the arg count
-        int argCount = sq_gettop(vm) - 2;
-
-        const SQChar* funcName;
-        sq_getstring(vm, -1, &funcName); // get the function name (free variable)
-
-        string overloadName = SqOverloadName::Get(funcName, argCount);
+        SQInteger argCount = sq_gettop(vm) - 2;
 
-        sq_pushstring(vm, overloadName.c_str(), -1);
+        sq_pushinteger(vm, argCount);
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        if (SQ_FAILED(sq_get(vm, 1))) { // Lookup the proper overload
+        if (SQ_FAILED(sq_rawget(vm, -2)) || sq_gettype(vm, -1) == OT_NULL) { // Lookup the proper overload
             return sq_throwerror(vm, _SC("wrong number of parameters"));
         }
 #else
-        sq_get(vm, 1);
+        sq_rawget(vm, -2);
 #endif
 
-        // Push the args again
-        for (int i = 1; i <= argCount + 1; ++i) {
-            sq_push(vm, i);
+        if (sq_gettype(vm, -1) == OT_ARRAY && !SqPushBestOverload(vm, argCount)) {
+            return sq_throwerror(vm, _SC("wrong type of parameters"));
         }
 
-#if !defined (SCRAT_NO_ERROR_CHECKING)
-        SQRESULT result = sq_call(vm, argCount + 1, false, ErrorHandling::IsEnabled());
-        if (SQ_FAILED(result)) {
-            return sq_throwerror(vm, LastErrorString(vm).c_str());
+        // Call the overload in place, it finds its method on top of the stack just as it would find a free variable
+        return sqAccessorFunc(vm, -1)(vm);
+    }
+};
+
+
+//
+// Overload binding
+//
+
+// Adds an overload taking argCount arguments to the handler named name in the table or class on top of the stack.
+// An overload with the same argument count and types as one already bound replaces it
+inline void SqBindOverload(HSQUIRRELVM vm, const SQChar* name, const void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func, SQFUNCTION overload, SQInteger argCount, bool staticVar = false) {
+    string overloadName = SqOverloadName::Get(name);
+
+    // Copy the overloads bound so far (the array may belong to a base class, which must not see the new overload)
+    sq_pushstring(vm, overloadName.c_str(), -1);
+    if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
+        if (sq_gettype(vm, -1) == OT_ARRAY) {
+            sq_clone(vm, -1);
+            sq_remove(vm, -2);
+        } else {
+            sq_pop(vm, 1);
+            sq_newarray(vm, 0);
         }
-#else
-        sq_call(vm, argCount + 1, false, ErrorHandling::IsEnabled());
-#endif
+    } else {
+        sq_newarray(vm, 0);
+    }
+    if (sq_getsize(vm, -1) <= argCount) {
+        sq_arrayresize(vm, -1, argCount + 1);
+    }
 
-        return 0;
+    // Find what already takes argCount arguments
+    sq_pushinteger(vm, argCount);
+    sq_rawget(vm, -2);
+    SQObjectType bound = sq_gettype(vm, -1);
+    if (bound == OT_ARRAY) {
+        sq_clone(vm, -1);
+        sq_remove(vm, -2);
+    } else if (bound == OT_USERDATA && SqOverloadMatchOf(vm, -1) != match) {
+        // Start a set of overloads that differ by argument types
+        sq_newarray(vm, 0);
+        sq_pushnull(vm); // the cache
+        sq_arrayappend(vm, -2);
+        sq_push(vm, -2);
+        sq_arrayappend(vm, -2);
+        sq_remove(vm, -2);
+        bound = OT_ARRAY;
+    } else {
+        sq_pop(vm, 1);
+        bound = OT_NULL;
     }
-};
+
+    if (bound == OT_ARRAY) {
+        // Replace the overload with the same argument types or add it to the set
+        SQInteger count = sq_getsize(vm, -1);
+        SQInteger slot = count;
+        for (SQInteger i = 1; i < count && slot == count; ++i) {
+            sq_pushinteger(vm, i);
+            sq_rawget(vm, -2);
+            if (SqOverloadMatchOf(vm, -1) == match) {
+                slot = i;
+            }
+            sq_pop(vm, 1);
+        }
+        if (slot == count) {
+            SqNewOverload(vm, method, methodSize, match, func);
+            sq_arrayappend(vm, -2);
+        } else {
+            sq_pushinteger(vm, slot);
+            SqNewOverload(vm, method, methodSize, match, func);
+            sq_set(vm, -3);
+        }
+
+        // The set gets a new cache because the set it was copied from may still use the old one
+        size_t cacheSize = SCRAT_OVERLOAD_CACHE_SIZE * (argCount + 1) * sizeof(size_t);
+        sq_pushinteger(vm, 0);
+        memset(sq_newuserdata(vm, static_cast<SQUnsignedInteger>(cacheSize)), 0, cacheSize);
+        sq_set(vm, -3);
+
+        sq_pushinteger(vm, argCount);
+        sq_push(vm, -2);
+        sq_set(vm, -4);
+        sq_pop(vm, 1); // pop set
+    } else {
+        sq_pushinteger(vm, argCount);
+        SqNewOverload(vm, method, methodSize, match, func);
+        sq_set(vm, -3);
+    }
+
+    // Keep the array so that later overloads can be added to it
+    sq_pushstring(vm, overloadName.c_str(), -1);
+    sq_push(vm, -2);
+    sq_newslot(vm, -4, staticVar);
+
+    // Bind overload handler
+    sq_pushstring(vm, name, -1);
+    sq_push(vm, -2); // the array is passed as a free variable
+    sq_newclosure(vm, overload, 1);
+    sq_newslot(vm, -4, staticVar);
+
+    sq_pop(vm, 1); // pop array
+}
 
 
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
 //
 // Global Overloaded Function Resolvers
 //
@@ -1168,6 +1311,559 @@ inline int SqGetArgCount(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9,
     return 14;
 }
 
+
+//
+// Overload Argument Matchers
+//
+
+// Scores how well the arguments starting at startIdx match A1, A2, ... (0 if any of them cannot be read, else higher is better)
+template <SQInteger startIdx, class A1 = void, class A2 = void, class A3 = void, class A4 = void, class A5 = void, class A6 = void, class A7 = void, class A8 = void, class A9 = void, class A10 = void, class A11 = void, class A12 = void, class A13 = void, class A14 = void>
+class SqOverloadMatch {
+public:
+
+    static SQInteger Score(HSQUIRRELVM vm) {
+        int score;
+        SQInteger total = 0;
+        score = ArgMatch<A1>::Score(vm, startIdx + 0);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A2>::Score(vm, startIdx + 1);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A3>::Score(vm, startIdx + 2);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A4>::Score(vm, startIdx + 3);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A5>::Score(vm, startIdx + 4);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A6>::Score(vm, startIdx + 5);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A7>::Score(vm, startIdx + 6);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A8>::Score(vm, startIdx + 7);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A9>::Score(vm, startIdx + 8);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A10>::Score(vm, startIdx + 9);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A11>::Score(vm, startIdx + 10);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A12>::Score(vm, startIdx + 11);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A13>::Score(vm, startIdx + 12);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        score = ArgMatch<A14>::Score(vm, startIdx + 13);
+        if (score == 0) {
+            return 0;
+        }
+        total += score;
+        return total;
+    }
+};
+
+
+//
+// Overload Argument Matcher Resolvers
+//
+
+// Arg Count 0
+template <class R>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)()) {
+    return &SqOverloadMatch<2>::Score;
+}
+
+template <class C, class R>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)()) {
+    return &SqOverloadMatch<2>::Score;
+}
+
+template <class C, class R>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)() const) {
+    return &SqOverloadMatch<2>::Score;
+}
+
+// Arg Count 1
+template <class R, class A1>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1)) {
+    return &SqOverloadMatch<2, A1>::Score;
+}
+
+template <class C, class R, class A1>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1)) {
+    return &SqOverloadMatch<2, A1>::Score;
+}
+
+template <class C, class R, class A1>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1) const) {
+    return &SqOverloadMatch<2, A1>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1)) {
+    return &SqOverloadMatch<2>::Score;
+}
+
+// Arg Count 2
+template <class R, class A1, class A2>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2)) {
+    return &SqOverloadMatch<2, A1, A2>::Score;
+}
+
+template <class C, class R, class A1, class A2>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2)) {
+    return &SqOverloadMatch<2, A1, A2>::Score;
+}
+
+template <class C, class R, class A1, class A2>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2) const) {
+    return &SqOverloadMatch<2, A1, A2>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2)) {
+    return &SqOverloadMatch<2, A2>::Score;
+}
+
+// Arg Count 3
+template <class R, class A1, class A2, class A3>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3)) {
+    return &SqOverloadMatch<2, A1, A2, A3>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3)) {
+    return &SqOverloadMatch<2, A1, A2, A3>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3) const) {
+    return &SqOverloadMatch<2, A1, A2, A3>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3)) {
+    return &SqOverloadMatch<2, A2, A3>::Score;
+}
+
+// Arg Count 4
+template <class R, class A1, class A2, class A3, class A4>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqOverloadMatch<2, A2, A3, A4>::Score;
+}
+
+// Arg Count 5
+template <class R, class A1, class A2, class A3, class A4, class A5>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5>::Score;
+}
+
+// Arg Count 6
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6>::Score;
+}
+
+// Arg Count 7
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7>::Score;
+}
+
+// Arg Count 8
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8>::Score;
+}
+
+// Arg Count 9
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9>::Score;
+}
+
+// Arg Count 10
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9, A10>::Score;
+}
+
+// Arg Count 11
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>::Score;
+}
+
+// Arg Count 12
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>::Score;
+}
+
+// Arg Count 13
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>::Score;
+}
+
+// Arg Count 14
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>::Score;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const) {
+    return &SqOverloadMatch<2, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqOverloadMatch<2, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>::Score;
+}
+
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+//
+// Global Overloaded Function Resolvers
+//
+
+template <class R, class... A>
+SQFUNCTION SqGlobalOverloadedFunc(R (* /*method*/)(A...)) {
+    return &SqGlobal<R>::template Func<2, true, A...>;
+}
+
+
+//
+// Member Global Overloaded Function Resolvers
+//
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class... A>
+SQFUNCTION SqMemberGlobalOverloadedFunc(R (* /*method*/)(A1, A...)) {
+    return &SqGlobal<R>::template Func<1, true, A1, A...>;
+}
+
+
+//
+// Member Overloaded Function Resolvers
+//
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberOverloadedFunc(R (C::* /*method*/)(A...)) {
+    return &SqMember<C, R>::template Func<true, A...>;
+}
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberOverloadedFunc(R (C::* /*method*/)(A...) const) {
+    return &SqMember<C, R>::template FuncC<true, A...>;
+}
+
+
+//
+// Overload handler resolver
+//
+
+template <class R>
+inline SQFUNCTION SqOverloadFunc(R (* /*method*/)) {
+    return &SqOverload<R>::Func;
+}
+
+template <class C, class R>
+inline SQFUNCTION SqOverloadFunc(R (C::* /*method*/)) {
+    return &SqOverload<R>::Func;
+}
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqOverloadFunc(R (C::* /*method*/)(A...) const ) {
+    return &SqOverload<R>::Func;
+}
+
+
+//
+// Query argument count
+//
+
+template <class R, class... A>
+inline int SqGetArgCount(R (* /*method*/)(A...)) {
+    return static_cast<int>(sizeof...(A));
+}
+
+template <class C, class R, class... A>
+inline int SqGetArgCount(R (C::* /*method*/)(A...)) {
+    return static_cast<int>(sizeof...(A));
+}
+
+template <class C, class R, class... A>
+inline int SqGetArgCount(R (C::* /*method*/)(A...) const) {
+    return static_cast<int>(sizeof...(A));
+}
+
+
+//
+// Overload Argument Matchers
+//
+
+// Scores how well the arguments starting at startIdx match A... (0 if any of them cannot be read, else higher is better)
+template <SQInteger startIdx, class... A>
+class SqOverloadMatch {
+public:
+
+    static SQInteger Score(HSQUIRRELVM vm) {
+        return Sum(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <size_t... I>
+    static SQInteger Sum(HSQUIRRELVM vm, index_sequence<I...>) {
+        SQUNUSED(vm); // when there are no arguments
+        // the leading 2 keeps the array non-empty for functions without arguments
+        int scores[] = {2, ArgMatch<A>::Score(vm, startIdx + static_cast<SQInteger>(I))...};
+        SQInteger total = 0;
+        for (size_t i = 1; i < sizeof(scores) / sizeof(scores[0]); ++i) {
+            if (scores[i] == 0) {
+                return 0;
+            }
+            total += scores[i];
+        }
+        return total;
+    }
+};
+
+
+//
+// Overload Argument Matcher Resolvers
+//
+
+template <class R, class... A>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (* /*method*/)(A...)) {
+    return &SqOverloadMatch<2, A...>::Score;
+}
+
+template <class C, class R, class... A>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A...)) {
+    return &SqOverloadMatch<2, A...>::Score;
+}
+
+template <class C, class R, class... A>
+inline OVERLOADMATCHFUNC SqOverloadMatchFunc(R (C::* /*method*/)(A...) const) {
+    return &SqOverloadMatch<2, A...>::Score;
+}
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class... A>
+inline OVERLOADMATCHFUNC SqMemberGlobalOverloadMatchFunc(R (* /*method*/)(A1, A...)) {
+    return &SqOverloadMatch<2, A...>::Score;
+}
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
 /// @endcond
 
 }
@@ -30,12 +30,308 @@
 
 #include <squirrel.h>
 #include <sqstdio.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 #include "sqratObject.h"
 
 namespace Sqrat {
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Opt-in cache of the byte code of the files compiled by Script::CompileFile
+///
+/// \remarks
+/// When enabled, Script::CompileFile first looks for a cache file holding the compiled closure of the source file. It is
+/// used (loaded with sq_readclosure) only if it was written for the same path, size, modification time and content hash
+/// as the source file has now. Otherwise the source is compiled as usual and the cache file is (re)written.
+///
+/// \remarks
+/// Cache files are written next to the source files (path + ".cache") or in a given directory (named after a hash of
+/// the path, which is stored in the file and checked). A cache file that cannot be read or written is ignored.
+/// Cache files are written to a temporary file first and renamed into place, so processes and threads compiling the
+/// same file at the same time never read a partially written cache file.
+///
+/// \remarks
+/// The settings are shared by all VMs and threads: change them before scripts are compiled.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class BytecodeCache {
+private:
+
+    static bool& staticEnabled() {
+        static bool enabled = false;
+        return enabled;
+    }
+
+    static string& staticDirectory() {
+        static string directory;
+        return directory;
+    }
+
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Enables the cache
+    ///
+    /// \param directory Directory the cache files are written to (empty to write them next to the source files)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void Enable(const string& directory = string()) {
+        staticEnabled() = true;
+        staticDirectory() = directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Disables the cache (files already written are kept)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void Disable() {
+        staticEnabled() = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Checks whether the cache is enabled
+    ///
+    /// \return True if Script::CompileFile uses the cache
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static bool IsEnabled() {
+        return staticEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the path of the cache file of a source file
+    ///
+    /// \param path File path of a Squirrel script
+    ///
+    /// \return File path the compiled script is cached at
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static string GetCachePath(const string& path) {
+        const string& directory = staticDirectory();
+        if (directory.empty()) {
+            return path + _SC(".cache");
+        }
+        unsigned int hash = Hash(path.data(), path.size() * sizeof(SQChar), FNV_BASIS);
+        string name = directory;
+        if (name[name.size() - 1] != _SC('/') && name[name.size() - 1] != _SC('\\')) {
+            name += _SC('/');
+        }
+        AppendHex(name, hash);
+        return name + _SC(".cnut");
+    }
+
+    /// @cond DEV
+
+    // Pushes the cached closure of a source file, returning false (and pushing nothing) if there is no valid one
+    static bool Load(HSQUIRRELVM vm, const string& path) {
+        CacheKey key;
+        if (!MakeKey(path, key)) {
+            return false;
+        }
+        SQFILE file = sqstd_fopen(GetCachePath(path).c_str(), _SC("rb"));
+        if (file == NULL) {
+            return false;
+        }
+        CacheKey cached;
+        string cachedPath(key.pathLength, 0);
+        bool valid = sqstd_fread(&cached, sizeof(cached), 1, file) == 1 &&
+                     memcmp(&cached, &key, sizeof(key)) == 0 &&
+                     (key.pathLength == 0 ||
+                      sqstd_fread(&cachedPath[0], key.pathLength * sizeof(SQChar), 1, file) == 1) &&
+                     cachedPath == path &&
+                     SQ_SUCCEEDED(sq_readclosure(vm, ReadFile, file));
+        sqstd_fclose(file);
+        return valid;
+    }
+
+    // Writes the closure on top of the stack to the cache file of a source file
+    static void Store(HSQUIRRELVM vm, const string& path) {
+        CacheKey key;
+        if (!MakeKey(path, key)) {
+            return;
+        }
+        string cachePath = GetCachePath(path);
+        string tempPath = TempPath(cachePath);
+        SQFILE file = sqstd_fopen(tempPath.c_str(), _SC("wb"));
+        if (file == NULL) {
+            return;
+        }
+        bool written = sqstd_fwrite(&key, sizeof(key), 1, file) == 1 &&
+                       (key.pathLength == 0 ||
+                        sqstd_fwrite(const_cast<SQChar*>(path.data()), key.pathLength * sizeof(SQChar), 1, file) == 1) &&
+                       SQ_SUCCEEDED(sq_writeclosure(vm, WriteFile, file));
+        sqstd_fclose(file);
+        if (!written || !Rename(tempPath, cachePath)) {
+            Remove(tempPath);
+        }
+    }
+
+    /// @endcond
+
+private:
+
+    enum {
+        MAGIC = 0x53514243, // "SQBC"
+        FNV_BASIS = 0x811C9DC5u,
+        FNV_PRIME = 0x01000193u
+    };
+
+    // Everything a cache file must match, written at its start (followed by the path)
+    struct CacheKey {
+        unsigned int magic;
+        unsigned int version;
+        unsigned int charSize;
+        unsigned int pathLength;
+        double       size;
+        double       mtime;
+        unsigned int hash;   // FNV-1a of the content
+        unsigned int hash2;  // FNV-1a of the content, with the size as offset basis
+    };
+
+    static unsigned int Hash(const void* data, size_t size, unsigned int hash) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ p[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // Unique name in the directory of the cache file (the process ID tells processes apart, the counter threads)
+    static string TempPath(const string& cachePath) {
+        static SpinLock lock;
+        static unsigned int counter;
+        unsigned int id;
+        {
+            SpinLockGuard guard(lock);
+            id = counter++;
+        }
+#if defined(_WIN32)
+        unsigned int pid = static_cast<unsigned int>(_getpid());
+#else
+        unsigned int pid = static_cast<unsigned int>(getpid());
+#endif
+        string temp = cachePath + _SC('.');
+        AppendHex(temp, pid);
+        temp += _SC('.');
+        AppendHex(temp, id);
+        return temp + _SC(".tmp");
+    }
+
+    static void AppendHex(string& str, unsigned int value) {
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            str += _SC("0123456789abcdef")[(value >> shift) & 0xF];
+        }
+    }
+
+    static bool MakeKey(const string& path, CacheKey& key) {
+        memset(&key, 0, sizeof(key)); // the padding is compared too
+        key.magic = MAGIC;
+        key.version = SQUIRREL_VERSION_NUMBER;
+        key.charSize = sizeof(SQChar);
+        key.pathLength = static_cast<unsigned int>(path.size());
+        if (!Stat(path, key.size, key.mtime)) {
+            return false;
+        }
+        SQFILE file = sqstd_fopen(path.c_str(), _SC("rb"));
+        if (file == NULL) {
+            return false;
+        }
+        size_t size = static_cast<size_t>(key.size);
+        char* content = static_cast<char*>(malloc(size + 1));
+        bool read = content != NULL && (size == 0 || sqstd_fread(content, size, 1, file) == 1);
+        sqstd_fclose(file);
+        if (read) {
+            key.hash = Hash(content, size, FNV_BASIS);
+            key.hash2 = Hash(content, size, FNV_BASIS ^ static_cast<unsigned int>(size));
+        }
+        free(content);
+        return read;
+    }
+
+#if defined(_WIN32)
+    static bool Stat(const string& path, double& size, double& mtime) {
+        struct _stat info;
+#if defined(SQUNICODE)
+        if (_wstat(path.c_str(), &info) != 0) {
+#else
+        if (_stat(path.c_str(), &info) != 0) {
+#endif
+            return false;
+        }
+        size = static_cast<double>(info.st_size);
+        mtime = static_cast<double>(info.st_mtime);
+        return true;
+    }
+
+    static void Remove(const string& path) {
+#if defined(SQUNICODE)
+        _wremove(path.c_str());
+#else
+        remove(path.c_str());
+#endif
+    }
+
+    // Windows does not replace an existing file: readers meanwhile find no cache file and compile the source
+    static bool Rename(const string& from, const string& to) {
+        Remove(to);
+#if defined(SQUNICODE)
+        return _wrename(from.c_str(), to.c_str()) == 0;
+#else
+        return rename(from.c_str(), to.c_str()) == 0;
+#endif
+    }
+#else
+    static std::string Narrow(const string& path) {
+#if defined(SQUNICODE)
+        std::string narrow(path.size() * MB_CUR_MAX + 1, 0);
+        size_t length = wcstombs(&narrow[0], path.c_str(), narrow.size());
+        narrow.resize(length == static_cast<size_t>(-1) ? 0 : length);
+        return narrow;
+#else
+        return path;
+#endif
+    }
+
+    static bool Stat(const string& path, double& size, double& mtime) {
+        struct stat info;
+        if (stat(Narrow(path).c_str(), &info) != 0) {
+            return false;
+        }
+        size = static_cast<double>(info.st_size);
+        mtime = static_cast<double>(info.st_mtime);
+        return true;
+    }
+
+    static void Remove(const string& path) {
+        remove(Narrow(path).c_str());
+    }
+
+    // Replaces the destination atomically
+    static bool Rename(const string& from, const string& to) {
+        return rename(Narrow(from).c_str(), Narrow(to).c_str()) == 0;
+    }
+#endif
+
+    static SQInteger ReadFile(SQUserPointer file, SQUserPointer buffer, SQInteger size) {
+        SQInteger read = sqstd_fread(buffer, 1, size, file);
+        return read != 0 ? read : -1;
+    }
+
+    static SQInteger WriteFile(SQUserPointer file, SQUserPointer buffer, SQInteger size) {
+        return sqstd_fwrite(buffer, 1, size, file);
+    }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Helper class for managing Squirrel scripts
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,12 +420,12 @@ public:
         }
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        if(SQ_FAILED(sqstd_loadfile(vm, path.c_str(), true))) {
+        if(SQ_FAILED(LoadFile(path))) {
             SQTHROW(vm, LastErrorString(vm));
             return;
         }
 #else
-        sqstd_loadfile(vm, path.c_str(), true);
+        LoadFile(path);
 #endif
         sq_getstackobj(vm,-1,&obj);
         sq_addref(vm, &obj);
@@ -150,12 +446,12 @@ public:
         }
 
 #if !defined (SCRAT_NO_ERROR_CHECKING)
-        if(SQ_FAILED(sqstd_loadfile(vm, path.c_str(), true))) {
+        if(SQ_FAILED(LoadFile(path))) {
             errMsg = LastErrorString(vm);
             return false;
         }
 #else
-        sqstd_loadfile(vm, path.c_str(), true);
+        LoadFile(path);
 #endif
         sq_getstackobj(vm,-1,&obj);
         sq_addref(vm, &obj);
@@ -236,6 +532,22 @@ public:
 #endif
         sq_pop(vm, 1); // needed?
     }
+
+private:
+
+    SQRESULT LoadFile(const string& path) {
+        if (!BytecodeCache::IsEnabled()) {
+            return sqstd_loadfile(vm, path.c_str(), true);
+        }
+        if (BytecodeCache::Load(vm, path)) {
+            return SQ_OK;
+        }
+        SQRESULT result = sqstd_loadfile(vm, path.c_str(), true);
+        if (SQ_SUCCEEDED(result)) {
+            BytecodeCache::Store(vm, path);
+        }
+        return result;
+    }
 };
 
 }
@@ -31,9 +31,11 @@
 #include <squirrel.h>
 #include <string.h>
 
+#include "sqratBinding.h"
 #include "sqratObject.h"
 #include "sqratFunction.h"
 #include "sqratGlobalMethods.h"
+#include "sqratUncheckedMethods.h"
 
 namespace Sqrat {
 
@@ -87,6 +89,16 @@ public:
         sq_pushobject(vm, obj.GetObject());
         sq_newslot(vm, -3, false);
         sq_pop(vm,1); // pop table
+
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            int classTarget = recorder->ClassTarget(vm, obj.GetObject());
+            if (classTarget != BindingSet::NO_TARGET) {
+                recorder->RecordBindClass(RecordedTarget(recorder), name, classTarget);
+            } else {
+                recorder->RecordUnsupported();
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +116,11 @@ public:
         sq_newclosure(vm, func, 0);
         sq_newslot(vm, -3, false);
         sq_pop(vm,1); // pop table
+
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordSquirrelFunc(RecordedTarget(recorder), name, func);
+        }
         return *this;
     }
 
@@ -192,6 +209,31 @@ public:
         return *this;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets a key in the Table to a specific function that is called without any error checking
+    ///
+    /// \param name   The key in the table being assigned a value
+    /// \param method Function that is being placed in the Table
+    ///
+    /// \tparam F Type of function (only define this if you need to choose a certain template specialization or overload)
+    ///
+    /// \return The Table itself so the call can be chained
+    ///
+    /// \remarks
+    /// Unlike Func, the function does not check the number of arguments it is called with nor the types of numbers and
+    /// does not look for errors while reading its arguments. It is meant for trusted functions on hot paths only: calling
+    /// it with arguments that do not match it is undefined behavior, and the function itself must not throw.
+    /// An error raised while reading an argument that is not a number is discarded (once per call, and only by functions
+    /// that have such an argument) so that it does not fail the next checked call, or with SCRAT_USE_EXCEPTIONS defined,
+    /// becomes a Squirrel error raised by the function.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class F>
+    TableBase& FuncUnchecked(const SQChar* name, F method) {
+        BindFunc(name, &method, sizeof(method), SqGlobalUncheckedFunc(method));
+        return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Sets a key in the Table to a specific function and allows the key to be overloaded with functions of a different amount of arguments
     ///
@@ -203,12 +245,13 @@ public:
     /// \return The Table itself so the call can be chained
     ///
     /// \remarks
-    /// Overloading in Sqrat does not work for functions with the same amount of arguments (just like in Squirrel).
+    /// Overloads are chosen by the number of arguments and then by their types. Functions taking the same
+    /// number of arguments are told apart by the Squirrel types of the values passed and by the bound classes of instances.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template<class F>
     TableBase& Overload(const SQChar* name, F method) {
-        BindOverload(name, &method, sizeof(method), SqGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
+        BindOverload(name, &method, sizeof(method), SqOverloadMatchFunc(method), SqGlobalOverloadedFunc(method), SqOverloadFunc(method), SqGetArgCount(method));
         return *this;
     }
 
@@ -232,6 +275,26 @@ public:
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Checks if the given key exists in the table
+    ///
+    /// \param name Interned key to check
+    ///
+    /// \return True on success, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool HasKey(const Key& name)
+    {
+        sq_pushobject(vm, obj);
+        name.Push(vm);
+        if (SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            return false;
+        }
+        sq_pop(vm, 2);
+        return true;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Returns the value at a given key
     ///
@@ -277,6 +340,51 @@ public:
         return SharedPtr<T>(); // avoid "not all control paths return a value" warning
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Returns the value at a given key
+    ///
+    /// \param name Interned key of the element
+    ///
+    /// \tparam T Type of value (fails if value is not of this type)
+    ///
+    /// \return SharedPtr containing the value (or null if failed)
+    ///
+    /// \remarks
+    /// This function MUST have its Error handled if it occurred.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    SharedPtr<T> GetValue(const Key& name)
+    {
+        sq_pushobject(vm, obj);
+        name.Push(vm);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if (SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            SQTHROW(vm, _SC("illegal index"));
+            return SharedPtr<T>();
+        }
+#else
+        sq_get(vm, -2);
+#endif
+        SQTRY()
+        Var<SharedPtr<T> > entry(vm, -1);
+        SQCATCH_NOEXCEPT(vm) {
+            sq_pop(vm, 2);
+            return SharedPtr<T>();
+        }
+        sq_pop(vm, 2);
+        return entry.value;
+        SQCATCH(vm) {
+#if defined (SCRAT_USE_EXCEPTIONS)
+            SQUNUSED(e); // avoid "unreferenced local variable" warning
+#endif
+            sq_pop(vm, 2);
+            SQRETHROW(vm);
+        }
+        return SharedPtr<T>(); // avoid "not all control paths return a value" warning
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Returns the value at a given index
     ///
@@ -353,6 +461,37 @@ public:
         return ret;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets a Function from a key in the Table
+    ///
+    /// \param name The interned key in the table that contains the Function
+    ///
+    /// \return Function found in the Table (null if failed)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Function GetFunction(const Key& name) {
+        HSQOBJECT funcObj;
+        sq_pushobject(vm, GetObject());
+        name.Push(vm);
+#if !defined (SCRAT_NO_ERROR_CHECKING)
+        if(SQ_FAILED(sq_get(vm, -2))) {
+            sq_pop(vm, 1);
+            return Function();
+        }
+        SQObjectType value_type = sq_gettype(vm, -1);
+        if (value_type != OT_CLOSURE && value_type != OT_NATIVECLOSURE) {
+            sq_pop(vm, 2);
+            return Function();
+        }
+#else
+        sq_get(vm, -2);
+#endif
+        sq_getstackobj(vm, -1, &funcObj);
+        Function ret(vm, GetObject(), funcObj); // must addref before the pop!
+        sq_pop(vm, 2);
+        return ret;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Gets a Function from an index in the Table
     ///
@@ -383,6 +522,75 @@ public:
         sq_pop(vm, 2);
         return ret;
     }
+
+protected:
+/// @cond DEV
+
+    // Gets the target of a BindingSet that is this table (only the root table can be recorded)
+    int RecordedTarget(BindingSet* recorder) {
+        if (!BindingSet::IsRootTable(vm, GetObject())) {
+            recorder->RecordUnsupported();
+            return BindingSet::NO_TARGET;
+        }
+        return BindingSet::ROOT_TARGET;
+    }
+
+    // Binding helpers of Object that also record the binding if the VM is being recorded by a BindingSet
+    inline void BindFunc(const SQChar* name, void* method, size_t methodSize, SQFUNCTION func, bool staticVar = false) {
+        Object::BindFunc(name, method, methodSize, func, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordFunc(RecordedTarget(recorder), name, method, methodSize, func, staticVar);
+        }
+    }
+
+    inline void BindOverload(const SQChar* name, void* method, size_t methodSize, OVERLOADMATCHFUNC match, SQFUNCTION func, SQFUNCTION overload, int argCount, bool staticVar = false) {
+        Object::BindOverload(name, method, methodSize, match, func, overload, argCount, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordOverload(RecordedTarget(recorder), name, method, methodSize, match, func, overload, argCount, staticVar);
+        }
+    }
+
+    template<class V>
+    inline void BindValue(const SQChar* name, const V& val, bool staticVar = false) {
+        Object::BindValue<V>(name, val, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            PushVar(vm, val);
+            recorder->RecordValue(vm, RecordedTarget(recorder), name, -1, staticVar);
+            sq_pop(vm, 1);
+        }
+    }
+
+    template<class V>
+    inline void BindValue(const SQInteger index, const V& val, bool staticVar = false) {
+        Object::BindValue<V>(index, val, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordUnsupported();
+        }
+    }
+
+    template<class V>
+    inline void BindInstance(const SQChar* name, V* val, bool staticVar = false) {
+        Object::BindInstance<V>(name, val, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordUnsupported();
+        }
+    }
+
+    template<class V>
+    inline void BindInstance(const SQInteger index, V* val, bool staticVar = false) {
+        Object::BindInstance<V>(index, val, staticVar);
+        BindingSet* recorder = BindingSet::GetRecorder(vm);
+        if (recorder != NULL) {
+            recorder->RecordUnsupported();
+        }
+    }
+
+/// @endcond
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
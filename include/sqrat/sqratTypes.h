@@ -482,7 +482,7 @@ struct Var<SharedPtr<T> > {
             SQCATCH_NOEXCEPT(vm) {
                 return;
             }
-            value.Init(new T(instance.value));
+            value = MakeShared<T>(instance.value);
         }
     }
 
@@ -758,6 +758,11 @@ struct Var<string> {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Var(HSQUIRRELVM vm, SQInteger idx) {
         const SQChar* ret;
+        if (sq_gettype(vm, idx) == OT_STRING) { // no need to convert it
+            sq_getstring(vm, idx, &ret);
+            value = string(ret, sq_getsize(vm, idx));
+            return;
+        }
         sq_tostring(vm, idx);
         sq_getstring(vm, -1, &ret);
         value = string(ret, sq_getsize(vm, -1));
@@ -793,6 +798,11 @@ struct Var<const string&> {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Var(HSQUIRRELVM vm, SQInteger idx) {
         const SQChar* ret;
+        if (sq_gettype(vm, idx) == OT_STRING) { // no need to convert it
+            sq_getstring(vm, idx, &ret);
+            value = string(ret, sq_getsize(vm, idx));
+            return;
+        }
         sq_tostring(vm, idx);
         sq_getstring(vm, -1, &ret);
         value = string(ret, sq_getsize(vm, -1));
@@ -811,6 +821,136 @@ struct Var<const string&> {
     }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Used to get and push StringViews to and from the stack without copying strings
+///
+/// \remarks
+/// String values are viewed right where they are on the stack. Other values are converted with tostring and the
+/// converted string is kept alive by the Var.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<>
+struct Var<StringView> {
+private:
+
+    HSQOBJECT obj; /* holds a reference to the converted string of a value that is not a string */
+    HSQUIRRELVM v;
+
+public:
+
+    StringView value; ///< The actual value of get operations
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Attempts to get the value off the stack at idx as a StringView
+    ///
+    /// \param vm  Target VM
+    /// \param idx Index trying to be read
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Var(HSQUIRRELVM vm, SQInteger idx) : v(vm) {
+        sq_resetobject(&obj);
+        const SQChar* ret;
+        if (sq_gettype(vm, idx) == OT_STRING) {
+            sq_getstring(vm, idx, &ret);
+            value = StringView(ret, sq_getsize(vm, idx));
+        } else {
+            sq_tostring(vm, idx);
+            sq_getstackobj(vm, -1, &obj);
+            sq_getstring(vm, -1, &ret);
+            value = StringView(ret, sq_getsize(vm, -1));
+            sq_addref(vm, &obj);
+            sq_pop(vm,1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Destructor
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ~Var()
+    {
+        if(!sq_isnull(obj)) {
+            sq_release(v, &obj);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat::PushVar to put a StringView on the stack
+    ///
+    /// \param vm    Target VM
+    /// \param value Value to push on to the VM's stack
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void push(HSQUIRRELVM vm, const StringView& value) {
+        sq_pushstring(vm, value.Data(), value.Size());
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Used to get and push const StringView references to and from the stack without copying strings
+///
+/// \remarks
+/// String values are viewed right where they are on the stack. Other values are converted with tostring and the
+/// converted string is kept alive by the Var.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<>
+struct Var<const StringView&> {
+private:
+
+    HSQOBJECT obj; /* holds a reference to the converted string of a value that is not a string */
+    HSQUIRRELVM v;
+
+public:
+
+    StringView value; ///< The actual value of get operations
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Attempts to get the value off the stack at idx as a StringView
+    ///
+    /// \param vm  Target VM
+    /// \param idx Index trying to be read
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Var(HSQUIRRELVM vm, SQInteger idx) : v(vm) {
+        sq_resetobject(&obj);
+        const SQChar* ret;
+        if (sq_gettype(vm, idx) == OT_STRING) {
+            sq_getstring(vm, idx, &ret);
+            value = StringView(ret, sq_getsize(vm, idx));
+        } else {
+            sq_tostring(vm, idx);
+            sq_getstackobj(vm, -1, &obj);
+            sq_getstring(vm, -1, &ret);
+            value = StringView(ret, sq_getsize(vm, -1));
+            sq_addref(vm, &obj);
+            sq_pop(vm,1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Destructor
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ~Var()
+    {
+        if(!sq_isnull(obj)) {
+            sq_release(v, &obj);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Called by Sqrat::PushVar to put a StringView on the stack
+    ///
+    /// \param vm    Target VM
+    /// \param value Value to push on to the VM's stack
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void push(HSQUIRRELVM vm, const StringView& value) {
+        sq_pushstring(vm, value.Data(), value.Size());
+    }
+};
+
 #ifdef SQUNICODE
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Used to get and push std::string to and from the stack when SQChar is not char (must define SQUNICODE)
@@ -1037,6 +1177,209 @@ SCRAT_MAKE_NONREFERENCABLE(std::string)
 #endif
 
 
+/// @cond DEV
+
+// Argument matching used to choose between overloads that take the same number of arguments.
+// Score returns 0 if the value at idx cannot be read as T, 1 if it can be converted to T and 2 if it is exactly a T
+inline int ArgMatchScore(SQObjectType type, SQObjectType exact, SQObjectType convertible1, SQObjectType convertible2) {
+    if (type == exact) {
+        return 2;
+    }
+    return (type == convertible1 || type == convertible2) ? 1 : 0;
+}
+
+template<class T>
+struct ArgMatch {
+    static int Score(HSQUIRRELVM vm, SQInteger idx) {
+        ClassData<T>* cd = ClassType<T>::findClassData(vm);
+        if (cd == NULL) { /* not a bound class (may be an enum or a type with its own Var), leave it to Var */
+            return 1;
+        }
+        if (sq_gettype(vm, idx) != OT_INSTANCE) {
+            return 0;
+        }
+        SQUserPointer classType = cd->staticData;
+        SQUserPointer actualType = GetNativeClassData(vm, idx); // the same for every call, even for Squirrel classes
+        if (actualType == classType) {
+            return 2;
+        }
+        SQUserPointer instance;
+        return SQ_SUCCEEDED(sq_getinstanceup(vm, idx, &instance, classType)) ? 1 : 0; /* derived classes convert to their bases */
+    }
+};
+
+template<class T>
+struct ArgMatch<const T> : ArgMatch<T> {};
+
+template<class T>
+struct ArgMatch<T&> : ArgMatch<T> {};
+
+template<class T>
+struct ArgMatch<T*> {
+    static int Score(HSQUIRRELVM vm, SQInteger idx) {
+        return sq_gettype(vm, idx) == OT_NULL ? 2 : ArgMatch<T>::Score(vm, idx);
+    }
+};
+
+template<class T>
+struct ArgMatch<SharedPtr<T> > : ArgMatch<T*> {};
+
+// Pads the argument lists of SqOverloadMatch, does not look at the stack
+template<>
+struct ArgMatch<void> {
+    static int Score(HSQUIRRELVM /*vm*/, SQInteger /*idx*/) {
+        return 2;
+    }
+};
+
+#define SCRAT_MATCH_TYPE( type, exact, convertible1, convertible2 ) \
+ template<> \
+ struct ArgMatch<type> { \
+     static int Score(HSQUIRRELVM vm, SQInteger idx) { \
+         return ArgMatchScore(sq_gettype(vm, idx), exact, convertible1, convertible2); \
+     } \
+ };
+
+// Types that any value converts to
+#define SCRAT_MATCH_ANY( type, exact ) \
+ template<> \
+ struct ArgMatch<type> { \
+     static int Score(HSQUIRRELVM vm, SQInteger idx) { \
+         return sq_gettype(vm, idx) == exact ? 2 : 1; \
+     } \
+ };
+
+SCRAT_MATCH_TYPE(unsigned int, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed int, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(unsigned long, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed long, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(unsigned short, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed short, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(unsigned char, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed char, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(unsigned long long, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed long long, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(float, OT_FLOAT, OT_INTEGER, OT_BOOL)
+SCRAT_MATCH_TYPE(double, OT_FLOAT, OT_INTEGER, OT_BOOL)
+
+#ifdef _MSC_VER
+#if defined(__int64)
+SCRAT_MATCH_TYPE(unsigned __int64, OT_INTEGER, OT_FLOAT, OT_BOOL)
+SCRAT_MATCH_TYPE(signed __int64, OT_INTEGER, OT_FLOAT, OT_BOOL)
+#endif
+#endif
+
+SCRAT_MATCH_ANY(bool, OT_BOOL)
+SCRAT_MATCH_ANY(SQChar*, OT_STRING)
+SCRAT_MATCH_ANY(const SQChar*, OT_STRING)
+SCRAT_MATCH_ANY(string, OT_STRING)
+SCRAT_MATCH_ANY(StringView, OT_STRING)
+
+#ifdef SQUNICODE
+SCRAT_MATCH_ANY(char*, OT_STRING)
+SCRAT_MATCH_ANY(const char*, OT_STRING)
+SCRAT_MATCH_ANY(std::string, OT_STRING)
+#endif
+
+// Reads the value at idx as a T without checking its type, for functions bound with Class::FuncUnchecked and
+// TableBase::FuncUnchecked. Numbers are read straight from the stack, every other type is read by its Var. mayRaise tells
+// whether that Var may raise an error, which the function then clears once all of its arguments are read (see UncheckedClear)
+template<class T>
+struct UncheckedVar : Var<T> {
+    static const bool mayRaise = true;
+    UncheckedVar(HSQUIRRELVM vm, SQInteger idx) : Var<T>(vm, idx) {}
+};
+
+#define SCRAT_UNCHECKED_QUIET( type ) \
+ template<> \
+ struct UncheckedVar<type> : Var<type> { \
+     static const bool mayRaise = false; \
+     UncheckedVar(HSQUIRRELVM vm, SQInteger idx) : Var<type>(vm, idx) {} \
+ };
+
+SCRAT_UNCHECKED_QUIET(bool)
+SCRAT_UNCHECKED_QUIET(const bool&)
+SCRAT_UNCHECKED_QUIET(SQChar*)
+SCRAT_UNCHECKED_QUIET(const SQChar*)
+SCRAT_UNCHECKED_QUIET(string)
+SCRAT_UNCHECKED_QUIET(const string&)
+SCRAT_UNCHECKED_QUIET(StringView)
+SCRAT_UNCHECKED_QUIET(const StringView&)
+
+#ifdef SQUNICODE
+SCRAT_UNCHECKED_QUIET(char*)
+SCRAT_UNCHECKED_QUIET(const char*)
+SCRAT_UNCHECKED_QUIET(std::string)
+SCRAT_UNCHECKED_QUIET(const std::string&)
+#endif
+
+#define SCRAT_UNCHECKED_NUMBER( type, sqtype, sqget ) \
+ template<> \
+ struct UncheckedVar<type> { \
+     static const bool mayRaise = false; \
+     type value; \
+     UncheckedVar(HSQUIRRELVM vm, SQInteger idx) { \
+         sqtype sqValue = 0; \
+         sqget(vm, idx, &sqValue); \
+         value = static_cast<type>(sqValue); \
+     } \
+ }; \
+ \
+ template<> \
+ struct UncheckedVar<const type&> : UncheckedVar<type> { \
+     UncheckedVar(HSQUIRRELVM vm, SQInteger idx) : UncheckedVar<type>(vm, idx) {} \
+ };
+
+SCRAT_UNCHECKED_NUMBER(unsigned int, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed int, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(unsigned long, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed long, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(unsigned short, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed short, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(unsigned char, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed char, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(unsigned long long, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed long long, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(float, SQFloat, sq_getfloat)
+SCRAT_UNCHECKED_NUMBER(double, SQFloat, sq_getfloat)
+
+#ifdef _MSC_VER
+#if defined(__int64)
+SCRAT_UNCHECKED_NUMBER(unsigned __int64, SQInteger, sq_getinteger)
+SCRAT_UNCHECKED_NUMBER(signed __int64, SQInteger, sq_getinteger)
+#endif
+#endif
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+// Holds the argument at idx read as an A (SqArgs has one of these as a base class per argument)
+template<SQInteger idx, class A>
+struct SqArg {
+    Var<A> var;
+    SqArg(HSQUIRRELVM vm) : var(vm, idx) {}
+};
+
+// Reads the arguments of a call starting at startIdx, in order (base classes are constructed in the order they are listed)
+template<SQInteger startIdx, class Indices, class... A>
+struct SqArgs;
+
+template<SQInteger startIdx, size_t... I, class... A>
+struct SqArgs<startIdx, index_sequence<I...>, A...> : SqArg<startIdx + static_cast<SQInteger>(I), A>... {
+    SqArgs(HSQUIRRELVM vm) : SqArg<startIdx + static_cast<SQInteger>(I), A>(vm)... {
+        SQUNUSED(vm); // when there are no arguments
+    }
+};
+
+template<SQInteger idx, class A>
+inline auto SqArgValue(SqArg<idx, A>& arg) -> decltype((arg.var.value)) {
+    return arg.var.value;
+}
+
+#endif
+
+/// @endcond
+
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Pushes a value on to a given VM's stack
 ///
@@ -0,0 +1,6400 @@
+//
+// SqratUncheckedMethods: Unchecked Global and Member Methods
+//
+
+//
+// Copyright (c) 2009 Brandon Jones
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+//  1. The origin of this software must not be misrepresented; you must not
+//  claim that you wrote the original software. If you use this software
+//  in a product, an acknowledgment in the product documentation would be
+//  appreciated but is not required.
+//
+//  2. Altered source versions must be plainly marked as such, and must not be
+//  misrepresented as being the original software.
+//
+//  3. This notice may not be removed or altered from any source
+//  distribution.
+//
+
+#if !defined(_SCRAT_UNCHECKED_METHODS_H_)
+#define _SCRAT_UNCHECKED_METHODS_H_
+
+#include <squirrel.h>
+#include "sqratTypes.h"
+
+namespace Sqrat {
+
+/// @cond DEV
+
+//
+// Functions bound with Class::FuncUnchecked and TableBase::FuncUnchecked. Unlike SqGlobal and SqMember, these
+// neither check the number of arguments nor look for errors after reading them, and numbers are read without
+// checking their types (see UncheckedVar). With exceptions, an exception thrown while reading the arguments becomes
+// a Squirrel error so that it never unwinds through the frames of the VM. Without them, an error raised while reading the
+// arguments is cleared once per call, and only by functions with an argument whose Var may raise one. The instance of
+// member functions is read without raising any error
+//
+
+// Clears the error reading the arguments may have raised (mayRaise is a constant, so the check costs nothing if false)
+inline void UncheckedClear(HSQUIRRELVM vm, bool mayRaise) {
+    SQUNUSED(vm);
+    if (mayRaise) {
+        SQCLEAR(vm);
+    }
+}
+
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+//
+// Squirrel Unchecked Global Functions
+//
+
+template <class R>
+class SqGlobalUnchecked {
+public:
+
+    // Arg Count 0
+    template <SQInteger startIdx>
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef R (*M)();
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        R ret = (*method)();
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 1
+    template <class A1, SQInteger startIdx>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef R (*M)(A1);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R ret = (*method)(
+                    a1.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2, SQInteger startIdx>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3, SQInteger startIdx>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4, SQInteger startIdx>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5, SQInteger startIdx>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6, SQInteger startIdx>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, SQInteger startIdx>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, SQInteger startIdx>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, SQInteger startIdx>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, SQInteger startIdx>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, SQInteger startIdx>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, SQInteger startIdx>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, SQInteger startIdx>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, SQInteger startIdx>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef R (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedVar<A14> a14(vm, startIdx + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class R>
+class SqGlobalUnchecked<R&> {
+public:
+
+    // Arg Count 0
+    template <SQInteger startIdx>
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef R& (*M)();
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        R& ret = (*method)();
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 1
+    template <class A1, SQInteger startIdx>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R& ret = (*method)(
+                    a1.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2, SQInteger startIdx>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3, SQInteger startIdx>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4, SQInteger startIdx>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5, SQInteger startIdx>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6, SQInteger startIdx>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, SQInteger startIdx>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, SQInteger startIdx>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, SQInteger startIdx>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, SQInteger startIdx>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, SQInteger startIdx>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, SQInteger startIdx>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, SQInteger startIdx>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, SQInteger startIdx>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef R& (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedVar<A14> a14(vm, startIdx + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R& ret = (*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <>
+class SqGlobalUnchecked<void> {
+public:
+
+    // Arg Count 0
+    template <SQInteger startIdx>
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef void (*M)();
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        (*method)();
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 1
+    template <class A1, SQInteger startIdx>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef void (*M)(A1);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        (*method)(
+            a1.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2, SQInteger startIdx>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3, SQInteger startIdx>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4, SQInteger startIdx>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5, SQInteger startIdx>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6, SQInteger startIdx>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, SQInteger startIdx>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, SQInteger startIdx>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, SQInteger startIdx>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, SQInteger startIdx>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, SQInteger startIdx>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, SQInteger startIdx>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, SQInteger startIdx>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, SQInteger startIdx>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef void (*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        UncheckedVar<A1> a1(vm, startIdx);
+        UncheckedVar<A2> a2(vm, startIdx + 1);
+        UncheckedVar<A3> a3(vm, startIdx + 2);
+        UncheckedVar<A4> a4(vm, startIdx + 3);
+        UncheckedVar<A5> a5(vm, startIdx + 4);
+        UncheckedVar<A6> a6(vm, startIdx + 5);
+        UncheckedVar<A7> a7(vm, startIdx + 6);
+        UncheckedVar<A8> a8(vm, startIdx + 7);
+        UncheckedVar<A9> a9(vm, startIdx + 8);
+        UncheckedVar<A10> a10(vm, startIdx + 9);
+        UncheckedVar<A11> a11(vm, startIdx + 10);
+        UncheckedVar<A12> a12(vm, startIdx + 11);
+        UncheckedVar<A13> a13(vm, startIdx + 12);
+        UncheckedVar<A14> a14(vm, startIdx + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        (*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value,
+            a14.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Squirrel Unchecked Member Functions
+//
+
+template <class C, class R>
+class SqMemberUnchecked {
+public:
+
+    // Arg Count 0
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef R (C::*M)();
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R ret = (ptr->*method)();
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    static SQInteger Func0C(HSQUIRRELVM vm) {
+        typedef R (C::*M)() const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R ret = (ptr->*method)();
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 1
+    template <class A1>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1>
+    static SQInteger Func1C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2>
+    static SQInteger Func2C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3>
+    static SQInteger Func3C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14C(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVar(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class C, class R>
+class SqMemberUnchecked<C, R&> {
+public:
+
+    // Arg Count 0
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef R& (C::*M)();
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R& ret = (ptr->*method)();
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    static SQInteger Func0C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)() const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R& ret = (ptr->*method)();
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 1
+    template <class A1>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1>
+    static SQInteger Func1C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2>
+    static SQInteger Func2C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3>
+    static SQInteger Func3C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14C(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        R& ret = (ptr->*method)(
+                    a1.value,
+                    a2.value,
+                    a3.value,
+                    a4.value,
+                    a5.value,
+                    a6.value,
+                    a7.value,
+                    a8.value,
+                    a9.value,
+                    a10.value,
+                    a11.value,
+                    a12.value,
+                    a13.value,
+                    a14.value
+                );
+        PushVarR(vm, ret);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <class C>
+class SqMemberUnchecked<C, void> {
+public:
+
+    // Arg Count 0
+    static SQInteger Func0(HSQUIRRELVM vm) {
+        typedef void (C::*M)();
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        (ptr->*method)();
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    static SQInteger Func0C(HSQUIRRELVM vm) {
+        typedef void (C::*M)() const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        (ptr->*method)();
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 1
+    template <class A1>
+    static SQInteger Func1(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        (ptr->*method)(
+            a1.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1>
+    static SQInteger Func1C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise);
+        (ptr->*method)(
+            a1.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 2
+    template <class A1, class A2>
+    static SQInteger Func2(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2>
+    static SQInteger Func2C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 3
+    template <class A1, class A2, class A3>
+    static SQInteger Func3(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3>
+    static SQInteger Func3C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 4
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4>
+    static SQInteger Func4C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 5
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5>
+    static SQInteger Func5C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 6
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    static SQInteger Func6C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 7
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+    static SQInteger Func7C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 8
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+    static SQInteger Func8C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 9
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+    static SQInteger Func9C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 10
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+    static SQInteger Func10C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 11
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+    static SQInteger Func11C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 12
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+    static SQInteger Func12C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 13
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+    static SQInteger Func13C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    // Arg Count 14
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value,
+            a14.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+
+    template <class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+    static SQInteger Func14C(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const;
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        UncheckedVar<A1> a1(vm, 2);
+        UncheckedVar<A2> a2(vm, 2 + 1);
+        UncheckedVar<A3> a3(vm, 2 + 2);
+        UncheckedVar<A4> a4(vm, 2 + 3);
+        UncheckedVar<A5> a5(vm, 2 + 4);
+        UncheckedVar<A6> a6(vm, 2 + 5);
+        UncheckedVar<A7> a7(vm, 2 + 6);
+        UncheckedVar<A8> a8(vm, 2 + 7);
+        UncheckedVar<A9> a9(vm, 2 + 8);
+        UncheckedVar<A10> a10(vm, 2 + 9);
+        UncheckedVar<A11> a11(vm, 2 + 10);
+        UncheckedVar<A12> a12(vm, 2 + 11);
+        UncheckedVar<A13> a13(vm, 2 + 12);
+        UncheckedVar<A14> a14(vm, 2 + 13);
+        UncheckedClear(vm, UncheckedVar<A1>::mayRaise ||
+                           UncheckedVar<A2>::mayRaise ||
+                           UncheckedVar<A3>::mayRaise ||
+                           UncheckedVar<A4>::mayRaise ||
+                           UncheckedVar<A5>::mayRaise ||
+                           UncheckedVar<A6>::mayRaise ||
+                           UncheckedVar<A7>::mayRaise ||
+                           UncheckedVar<A8>::mayRaise ||
+                           UncheckedVar<A9>::mayRaise ||
+                           UncheckedVar<A10>::mayRaise ||
+                           UncheckedVar<A11>::mayRaise ||
+                           UncheckedVar<A12>::mayRaise ||
+                           UncheckedVar<A13>::mayRaise ||
+                           UncheckedVar<A14>::mayRaise);
+        (ptr->*method)(
+            a1.value,
+            a2.value,
+            a3.value,
+            a4.value,
+            a5.value,
+            a6.value,
+            a7.value,
+            a8.value,
+            a9.value,
+            a10.value,
+            a11.value,
+            a12.value,
+            a13.value,
+            a14.value
+        );
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Global Unchecked Function Resolvers
+//
+
+// Arg Count 0
+template <class R>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)()) {
+    return &SqGlobalUnchecked<R>::template Func0<2>;
+}
+
+template <class R>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)()) {
+    return &SqGlobalUnchecked<R&>::template Func0<2>;
+}
+
+// Arg Count 1
+template <class R, class A1>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1)) {
+    return &SqGlobalUnchecked<R>::template Func1<A1, 2>;
+}
+
+template <class R, class A1>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1)) {
+    return &SqGlobalUnchecked<R&>::template Func1<A1, 2>;
+}
+
+// Arg Count 2
+template <class R, class A1, class A2>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2)) {
+    return &SqGlobalUnchecked<R>::template Func2<A1, A2, 2>;
+}
+
+template <class R, class A1, class A2>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2)) {
+    return &SqGlobalUnchecked<R&>::template Func2<A1, A2, 2>;
+}
+
+// Arg Count 3
+template <class R, class A1, class A2, class A3>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3)) {
+    return &SqGlobalUnchecked<R>::template Func3<A1, A2, A3, 2>;
+}
+
+template <class R, class A1, class A2, class A3>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3)) {
+    return &SqGlobalUnchecked<R&>::template Func3<A1, A2, A3, 2>;
+}
+
+// Arg Count 4
+template <class R, class A1, class A2, class A3, class A4>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqGlobalUnchecked<R>::template Func4<A1, A2, A3, A4, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqGlobalUnchecked<R&>::template Func4<A1, A2, A3, A4, 2>;
+}
+
+// Arg Count 5
+template <class R, class A1, class A2, class A3, class A4, class A5>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqGlobalUnchecked<R>::template Func5<A1, A2, A3, A4, A5, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqGlobalUnchecked<R&>::template Func5<A1, A2, A3, A4, A5, 2>;
+}
+
+// Arg Count 6
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqGlobalUnchecked<R>::template Func6<A1, A2, A3, A4, A5, A6, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqGlobalUnchecked<R&>::template Func6<A1, A2, A3, A4, A5, A6, 2>;
+}
+
+// Arg Count 7
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqGlobalUnchecked<R>::template Func7<A1, A2, A3, A4, A5, A6, A7, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqGlobalUnchecked<R&>::template Func7<A1, A2, A3, A4, A5, A6, A7, 2>;
+}
+
+// Arg Count 8
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqGlobalUnchecked<R>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqGlobalUnchecked<R&>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8, 2>;
+}
+
+// Arg Count 9
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqGlobalUnchecked<R>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqGlobalUnchecked<R&>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9, 2>;
+}
+
+// Arg Count 10
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqGlobalUnchecked<R>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqGlobalUnchecked<R&>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, 2>;
+}
+
+// Arg Count 11
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqGlobalUnchecked<R>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqGlobalUnchecked<R&>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, 2>;
+}
+
+// Arg Count 12
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqGlobalUnchecked<R>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqGlobalUnchecked<R&>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, 2>;
+}
+
+// Arg Count 13
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqGlobalUnchecked<R>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqGlobalUnchecked<R&>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, 2>;
+}
+
+// Arg Count 14
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqGlobalUnchecked<R>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, 2>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+SQFUNCTION SqGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqGlobalUnchecked<R&>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, 2>;
+}
+
+
+//
+// Member Global Unchecked Function Resolvers
+//
+
+// Arg Count 1
+template <class R, class A1>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1)) {
+    return &SqGlobalUnchecked<R>::template Func1<A1, 1>;
+}
+
+template <class R, class A1>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1)) {
+    return &SqGlobalUnchecked<R&>::template Func1<A1, 1>;
+}
+
+// Arg Count 2
+template <class R, class A1, class A2>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2)) {
+    return &SqGlobalUnchecked<R>::template Func2<A1, A2, 1>;
+}
+
+template <class R, class A1, class A2>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2)) {
+    return &SqGlobalUnchecked<R&>::template Func2<A1, A2, 1>;
+}
+
+// Arg Count 3
+template <class R, class A1, class A2, class A3>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3)) {
+    return &SqGlobalUnchecked<R>::template Func3<A1, A2, A3, 1>;
+}
+
+template <class R, class A1, class A2, class A3>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3)) {
+    return &SqGlobalUnchecked<R&>::template Func3<A1, A2, A3, 1>;
+}
+
+// Arg Count 4
+template <class R, class A1, class A2, class A3, class A4>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqGlobalUnchecked<R>::template Func4<A1, A2, A3, A4, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4)) {
+    return &SqGlobalUnchecked<R&>::template Func4<A1, A2, A3, A4, 1>;
+}
+
+// Arg Count 5
+template <class R, class A1, class A2, class A3, class A4, class A5>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqGlobalUnchecked<R>::template Func5<A1, A2, A3, A4, A5, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqGlobalUnchecked<R&>::template Func5<A1, A2, A3, A4, A5, 1>;
+}
+
+// Arg Count 6
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqGlobalUnchecked<R>::template Func6<A1, A2, A3, A4, A5, A6, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqGlobalUnchecked<R&>::template Func6<A1, A2, A3, A4, A5, A6, 1>;
+}
+
+// Arg Count 7
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqGlobalUnchecked<R>::template Func7<A1, A2, A3, A4, A5, A6, A7, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqGlobalUnchecked<R&>::template Func7<A1, A2, A3, A4, A5, A6, A7, 1>;
+}
+
+// Arg Count 8
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqGlobalUnchecked<R>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqGlobalUnchecked<R&>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8, 1>;
+}
+
+// Arg Count 9
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqGlobalUnchecked<R>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqGlobalUnchecked<R&>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9, 1>;
+}
+
+// Arg Count 10
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqGlobalUnchecked<R>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqGlobalUnchecked<R&>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, 1>;
+}
+
+// Arg Count 11
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqGlobalUnchecked<R>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqGlobalUnchecked<R&>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, 1>;
+}
+
+// Arg Count 12
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqGlobalUnchecked<R>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqGlobalUnchecked<R&>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, 1>;
+}
+
+// Arg Count 13
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqGlobalUnchecked<R>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqGlobalUnchecked<R&>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, 1>;
+}
+
+// Arg Count 14
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqGlobalUnchecked<R>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, 1>;
+}
+
+template <class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R& (* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqGlobalUnchecked<R&>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, 1>;
+}
+
+
+//
+// Member Unchecked Function Resolvers
+//
+
+// Arg Count 0
+template <class C, class R>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)()) {
+    return &SqMemberUnchecked<C, R>::Func0;
+}
+
+template <class C, class R>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)() const) {
+    return &SqMemberUnchecked<C, R>::Func0C;
+}
+
+template <class C, class R>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)()) {
+    return &SqMemberUnchecked<C, R&>::Func0;
+}
+
+template <class C, class R>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)() const) {
+    return &SqMemberUnchecked<C, R&>::Func0C;
+}
+
+// Arg Count 1
+template <class C, class R, class A1>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1)) {
+    return &SqMemberUnchecked<C, R>::template Func1<A1>;
+}
+
+template <class C, class R, class A1>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1) const) {
+    return &SqMemberUnchecked<C, R>::template Func1C<A1>;
+}
+
+template <class C, class R, class A1>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1)) {
+    return &SqMemberUnchecked<C, R&>::template Func1<A1>;
+}
+
+template <class C, class R, class A1>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1) const) {
+    return &SqMemberUnchecked<C, R&>::template Func1C<A1>;
+}
+
+// Arg Count 2
+template <class C, class R, class A1, class A2>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2)) {
+    return &SqMemberUnchecked<C, R>::template Func2<A1, A2>;
+}
+
+template <class C, class R, class A1, class A2>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2) const) {
+    return &SqMemberUnchecked<C, R>::template Func2C<A1, A2>;
+}
+
+template <class C, class R, class A1, class A2>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2)) {
+    return &SqMemberUnchecked<C, R&>::template Func2<A1, A2>;
+}
+
+template <class C, class R, class A1, class A2>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2) const) {
+    return &SqMemberUnchecked<C, R&>::template Func2C<A1, A2>;
+}
+
+// Arg Count 3
+template <class C, class R, class A1, class A2, class A3>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3)) {
+    return &SqMemberUnchecked<C, R>::template Func3<A1, A2, A3>;
+}
+
+template <class C, class R, class A1, class A2, class A3>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3) const) {
+    return &SqMemberUnchecked<C, R>::template Func3C<A1, A2, A3>;
+}
+
+template <class C, class R, class A1, class A2, class A3>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3)) {
+    return &SqMemberUnchecked<C, R&>::template Func3<A1, A2, A3>;
+}
+
+template <class C, class R, class A1, class A2, class A3>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3) const) {
+    return &SqMemberUnchecked<C, R&>::template Func3C<A1, A2, A3>;
+}
+
+// Arg Count 4
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4)) {
+    return &SqMemberUnchecked<C, R>::template Func4<A1, A2, A3, A4>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4) const) {
+    return &SqMemberUnchecked<C, R>::template Func4C<A1, A2, A3, A4>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4)) {
+    return &SqMemberUnchecked<C, R&>::template Func4<A1, A2, A3, A4>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4) const) {
+    return &SqMemberUnchecked<C, R&>::template Func4C<A1, A2, A3, A4>;
+}
+
+// Arg Count 5
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqMemberUnchecked<C, R>::template Func5<A1, A2, A3, A4, A5>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5) const) {
+    return &SqMemberUnchecked<C, R>::template Func5C<A1, A2, A3, A4, A5>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5)) {
+    return &SqMemberUnchecked<C, R&>::template Func5<A1, A2, A3, A4, A5>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5) const) {
+    return &SqMemberUnchecked<C, R&>::template Func5C<A1, A2, A3, A4, A5>;
+}
+
+// Arg Count 6
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqMemberUnchecked<C, R>::template Func6<A1, A2, A3, A4, A5, A6>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6) const) {
+    return &SqMemberUnchecked<C, R>::template Func6C<A1, A2, A3, A4, A5, A6>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6)) {
+    return &SqMemberUnchecked<C, R&>::template Func6<A1, A2, A3, A4, A5, A6>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6) const) {
+    return &SqMemberUnchecked<C, R&>::template Func6C<A1, A2, A3, A4, A5, A6>;
+}
+
+// Arg Count 7
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqMemberUnchecked<C, R>::template Func7<A1, A2, A3, A4, A5, A6, A7>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7) const) {
+    return &SqMemberUnchecked<C, R>::template Func7C<A1, A2, A3, A4, A5, A6, A7>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7)) {
+    return &SqMemberUnchecked<C, R&>::template Func7<A1, A2, A3, A4, A5, A6, A7>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7) const) {
+    return &SqMemberUnchecked<C, R&>::template Func7C<A1, A2, A3, A4, A5, A6, A7>;
+}
+
+// Arg Count 8
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqMemberUnchecked<C, R>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8) const) {
+    return &SqMemberUnchecked<C, R>::template Func8C<A1, A2, A3, A4, A5, A6, A7, A8>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8)) {
+    return &SqMemberUnchecked<C, R&>::template Func8<A1, A2, A3, A4, A5, A6, A7, A8>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8) const) {
+    return &SqMemberUnchecked<C, R&>::template Func8C<A1, A2, A3, A4, A5, A6, A7, A8>;
+}
+
+// Arg Count 9
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqMemberUnchecked<C, R>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const) {
+    return &SqMemberUnchecked<C, R>::template Func9C<A1, A2, A3, A4, A5, A6, A7, A8, A9>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9)) {
+    return &SqMemberUnchecked<C, R&>::template Func9<A1, A2, A3, A4, A5, A6, A7, A8, A9>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9) const) {
+    return &SqMemberUnchecked<C, R&>::template Func9C<A1, A2, A3, A4, A5, A6, A7, A8, A9>;
+}
+
+// Arg Count 10
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqMemberUnchecked<C, R>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const) {
+    return &SqMemberUnchecked<C, R>::template Func10C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)) {
+    return &SqMemberUnchecked<C, R&>::template Func10<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10) const) {
+    return &SqMemberUnchecked<C, R&>::template Func10C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10>;
+}
+
+// Arg Count 11
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqMemberUnchecked<C, R>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const) {
+    return &SqMemberUnchecked<C, R>::template Func11C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)) {
+    return &SqMemberUnchecked<C, R&>::template Func11<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11) const) {
+    return &SqMemberUnchecked<C, R&>::template Func11C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11>;
+}
+
+// Arg Count 12
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqMemberUnchecked<C, R>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const) {
+    return &SqMemberUnchecked<C, R>::template Func12C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)) {
+    return &SqMemberUnchecked<C, R&>::template Func12<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12) const) {
+    return &SqMemberUnchecked<C, R&>::template Func12C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12>;
+}
+
+// Arg Count 13
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqMemberUnchecked<C, R>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const) {
+    return &SqMemberUnchecked<C, R>::template Func13C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)) {
+    return &SqMemberUnchecked<C, R&>::template Func13<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13) const) {
+    return &SqMemberUnchecked<C, R&>::template Func13C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13>;
+}
+
+// Arg Count 14
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqMemberUnchecked<C, R>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const) {
+    return &SqMemberUnchecked<C, R>::template Func14C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)) {
+    return &SqMemberUnchecked<C, R&>::template Func14<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>;
+}
+
+template <class C, class R, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
+inline SQFUNCTION SqMemberUncheckedFunc(R& (C::* /*method*/)(A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14) const) {
+    return &SqMemberUnchecked<C, R&>::template Func14C<A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14>;
+}
+
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+// Whether the Var of any of the arguments may raise an error (see UncheckedVar)
+template <class... A>
+struct UncheckedMayRaise {
+    static const bool value = false;
+};
+
+template <class A1, class... A>
+struct UncheckedMayRaise<A1, A...> {
+    static const bool value = UncheckedVar<A1>::mayRaise || UncheckedMayRaise<A...>::value;
+};
+
+//
+// Squirrel Unchecked Global Functions
+//
+
+template <class R>
+class SqGlobalUnchecked {
+public:
+
+    template <SQInteger startIdx, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <SQInteger startIdx, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        typedef R (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        R ret = (*method)(
+                    UncheckedVar<A>(vm, startIdx + static_cast<SQInteger>(I)).value...
+                );
+        PushVar(vm, ret);
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class R>
+class SqGlobalUnchecked<R&> {
+public:
+
+    template <SQInteger startIdx, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <SQInteger startIdx, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        typedef R& (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        R& ret = (*method)(
+                    UncheckedVar<A>(vm, startIdx + static_cast<SQInteger>(I)).value...
+                );
+        PushVarR(vm, ret);
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <>
+class SqGlobalUnchecked<void> {
+public:
+
+    template <SQInteger startIdx, class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        return Call<startIdx, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <SQInteger startIdx, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        typedef void (*M)(A...);
+        M* method;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&method, NULL);
+        SQTRY()
+        (*method)(
+            UncheckedVar<A>(vm, startIdx + static_cast<SQInteger>(I)).value...
+        );
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Squirrel Unchecked Member Functions
+//
+
+template <class C, class R>
+class SqMemberUnchecked {
+public:
+
+    template <class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A...);
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef R (C::*M)(A...) const;
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R ret = (ptr->*method)(
+                    UncheckedVar<A>(vm, 2 + static_cast<SQInteger>(I)).value...
+                );
+        PushVar(vm, ret);
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// reference return specialization
+//
+
+template <class C, class R>
+class SqMemberUnchecked<C, R&> {
+public:
+
+    template <class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A...);
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef R& (C::*M)(A...) const;
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        R& ret = (ptr->*method)(
+                    UncheckedVar<A>(vm, 2 + static_cast<SQInteger>(I)).value...
+                );
+        PushVarR(vm, ret);
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 1;
+    }
+};
+
+
+//
+// void return specialization
+//
+
+template <class C>
+class SqMemberUnchecked<C, void> {
+public:
+
+    template <class... A>
+    static SQInteger Func(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A...);
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+    template <class... A>
+    static SQInteger FuncC(HSQUIRRELVM vm) {
+        typedef void (C::*M)(A...) const;
+        return Call<M, A...>(vm, make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    // the argument temporaries live until the call returns
+    template <class M, class... A, size_t... I>
+    static SQInteger Call(HSQUIRRELVM vm, index_sequence<I...>) {
+        M* methodPtr;
+        sq_getuserdata(vm, -1, (SQUserPointer*)&methodPtr, NULL);
+        SQTRY()
+        M method = *methodPtr;
+        C* ptr = ClassType<C>::GetInstanceQuiet(vm, 1);
+        if (ptr == NULL) {
+            return sq_throwerror(vm, _SC("the instance is not of the class of the function or not constructed"));
+        }
+        (ptr->*method)(
+            UncheckedVar<A>(vm, 2 + static_cast<SQInteger>(I)).value...
+        );
+        UncheckedClear(vm, UncheckedMayRaise<A...>::value);
+        SQCATCH(vm) {
+            return sq_throwerror(vm, SQWHAT(vm));
+        }
+        return 0;
+    }
+};
+
+
+//
+// Global Unchecked Function Resolvers
+//
+
+template <class R, class... A>
+SQFUNCTION SqGlobalUncheckedFunc(R (* /*method*/)(A...)) {
+    return &SqGlobalUnchecked<R>::template Func<2, A...>;
+}
+
+
+//
+// Member Global Unchecked Function Resolvers
+//
+
+// the first argument is the instance the function is called on
+template <class R, class A1, class... A>
+SQFUNCTION SqMemberGlobalUncheckedFunc(R (* /*method*/)(A1, A...)) {
+    return &SqGlobalUnchecked<R>::template Func<1, A1, A...>;
+}
+
+
+//
+// Member Unchecked Function Resolvers
+//
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A...)) {
+    return &SqMemberUnchecked<C, R>::template Func<A...>;
+}
+
+template <class C, class R, class... A>
+inline SQFUNCTION SqMemberUncheckedFunc(R (C::* /*method*/)(A...) const) {
+    return &SqMemberUnchecked<C, R>::template FuncC<A...>;
+}
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+/// @endcond
+
+}
+
+#endif
@@ -30,11 +30,27 @@
 
 #include <cassert>
 #include <map>
+#include <new>
 #include <squirrel.h>
 #include <string.h>
+#include <vector>
 
 #if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
 #include <unordered_map>
+#include <utility>
+#endif
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+#include <atomic>
+#include <thread>
+#elif defined(_WIN32)
+extern "C" __declspec(dllimport) int __stdcall SwitchToThread(void); // same declaration as windows.h, not included for its macros
+#else
+#include <sched.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
 #endif
 
 namespace Sqrat {
@@ -59,6 +75,152 @@ namespace Sqrat {
     };
 #endif
 
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Sequence of indices used to expand argument packs in step with their positions (std::index_sequence is C++14)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<size_t... I>
+struct index_sequence {};
+
+template<size_t N, size_t... I>
+struct make_index_sequence_helper : make_index_sequence_helper<N - 1, N - 1, I...> {};
+
+template<size_t... I>
+struct make_index_sequence_helper<0, I...> {
+    typedef index_sequence<I...> type;
+};
+
+template<size_t N>
+using make_index_sequence = typename make_index_sequence_helper<N>::type;
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Open addressing hash map keyed by pointers (linear probing, no tombstones), used to track the instances of classes
+///
+/// \tparam K Pointer type used as the key
+/// \tparam V Type of the values (must be default constructible and copyable)
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<class K, class V>
+class PointerMap {
+public:
+
+    PointerMap() : m_Size(0), m_HasNull(false), m_NullValue() {}
+
+    // Returns the value of key or NULL if key is not in the map
+    V* Find(K key) {
+        if (key == NULL) {
+            return m_HasNull ? &m_NullValue : NULL;
+        }
+        if (m_Slots.empty()) {
+            return NULL;
+        }
+        size_t mask = m_Slots.size() - 1;
+        for (size_t i = Hash(key) & mask; m_Slots[i].key != NULL; i = (i + 1) & mask) {
+            if (m_Slots[i].key == key) {
+                return &m_Slots[i].value;
+            }
+        }
+        return NULL;
+    }
+
+    // Returns the value of key, inserting a default constructed one if key is not in the map
+    V& operator[](K key) {
+        if (key == NULL) {
+            if (!m_HasNull) {
+                m_HasNull   = true;
+                m_NullValue = V();
+                ++m_Size;
+            }
+            return m_NullValue;
+        }
+        if ((m_Size + 1) * 2 > m_Slots.size()) {
+            Rehash(m_Slots.empty() ? 16 : m_Slots.size() * 2);
+        }
+        size_t mask = m_Slots.size() - 1;
+        size_t i = Hash(key) & mask;
+        for (; m_Slots[i].key != NULL; i = (i + 1) & mask) {
+            if (m_Slots[i].key == key) {
+                return m_Slots[i].value;
+            }
+        }
+        m_Slots[i].key   = key;
+        m_Slots[i].value = V();
+        ++m_Size;
+        return m_Slots[i].value;
+    }
+
+    // Removes key from the map (does nothing if it is not in it)
+    void Erase(K key) {
+        if (key == NULL) {
+            if (m_HasNull) {
+                m_HasNull = false;
+                --m_Size;
+            }
+            return;
+        }
+        if (m_Slots.empty()) {
+            return;
+        }
+        size_t mask = m_Slots.size() - 1;
+        size_t i = Hash(key) & mask;
+        for (; m_Slots[i].key != key; i = (i + 1) & mask) {
+            if (m_Slots[i].key == NULL) {
+                return;
+            }
+        }
+        // shift back the entries that probed past the erased one so lookups never need tombstones
+        for (size_t j = (i + 1) & mask; m_Slots[j].key != NULL; j = (j + 1) & mask) {
+            size_t home = Hash(m_Slots[j].key) & mask;
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                m_Slots[i] = m_Slots[j];
+                i = j;
+            }
+        }
+        m_Slots[i].key = NULL;
+        --m_Size;
+    }
+
+    size_t Size() const {
+        return m_Size;
+    }
+
+private:
+
+    struct Slot {
+        Slot() : key(NULL), value() {}
+        K key;
+        V value;
+    };
+
+    static size_t Hash(K key) {
+        size_t h = reinterpret_cast<size_t>(key);
+        h ^= h >> 4;  // objects are aligned so the lowest bits carry little information
+        h *= 2654435761u;
+        return h ^ (h >> 16);
+    }
+
+    void Rehash(size_t capacity) {
+        std::vector<Slot> old(capacity);
+        old.swap(m_Slots);
+        size_t mask = capacity - 1;
+        for (size_t n = 0; n < old.size(); ++n) {
+            if (old[n].key != NULL) {
+                size_t i = Hash(old[n].key) & mask;
+                while (m_Slots[i].key != NULL) {
+                    i = (i + 1) & mask;
+                }
+                m_Slots[i] = old[n];
+            }
+        }
+    }
+
+    std::vector<Slot> m_Slots; // the capacity is always a power of two kept at least twice the size
+    size_t            m_Size;
+    bool              m_HasNull; // NULL marks empty slots so a NULL key is stored on the side
+    V                 m_NullValue;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Define an inline function to avoid MSVC's "conditional expression is constant" warning
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +319,105 @@ void SQUNUSED(const T&) {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 typedef std::basic_string<SQChar> string;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Non-owning view of a Squirrel string, used as the type of string arguments of native functions to read them
+/// without copying them
+///
+/// \remarks
+/// A StringView read from an argument is only valid until the native function returns. Copy it into a string to keep it.
+///
+/// \remarks
+/// Like every Squirrel string, the characters viewed are followed by a null-character.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class StringView {
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Constructs an empty StringView
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    StringView() : ptr(_SC("")), len(0) {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Constructs a StringView of the given characters
+    ///
+    /// \param s      Characters to view (must be followed by a null-character)
+    /// \param length Number of characters (defaults to finding the length by searching for the terminating null-character)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    StringView(const SQChar* s, SQInteger length = -1) : ptr(s), len(length >= 0 ? length : static_cast<SQInteger>(scstrlen(s))) {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the characters viewed
+    ///
+    /// \return Pointer to the first character (the characters are followed by a null-character)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const SQChar* Data() const {
+        return ptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the number of characters viewed
+    ///
+    /// \return Number of characters (the terminating null-character is not counted)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SQInteger Size() const {
+        return len;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Checks whether the StringView is empty
+    ///
+    /// \return True if no characters are viewed, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool Empty() const {
+        return len == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Copies the characters viewed into a string
+    ///
+    /// \return A string holding a copy of the characters
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    string ToString() const {
+        return string(ptr, static_cast<size_t>(len));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Compares the characters viewed with the characters of another StringView
+    ///
+    /// \param other StringView to compare with
+    ///
+    /// \return True if both view the same characters, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool operator==(const StringView& other) const {
+        return len == other.len && memcmp(ptr, other.ptr, static_cast<size_t>(len) * sizeof(SQChar)) == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Compares the characters viewed with the characters of another StringView
+    ///
+    /// \param other StringView to compare with
+    ///
+    /// \return True if they view different characters, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool operator!=(const StringView& other) const {
+        return !(*this == other);
+    }
+
+private:
+
+    const SQChar* ptr;
+    SQInteger     len;
+};
+
 /// @cond DEV
 #ifdef SQUNICODE
 /* from http://stackoverflow.com/questions/15333259/c-stdwstring-to-stdstring-quick-and-dirty-conversion-for-use-as-key-in,
@@ -185,40 +446,456 @@ class SharedPtr;
 template <class T>
 class WeakPtr;
 
-/// @endcond
+/// @endcond
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Helper class that defines a VM that can be used as a fallback VM in case no other one is given to a piece of code
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class DefaultVM {
+private:
+
+    static HSQUIRRELVM& staticVm() {
+        static HSQUIRRELVM vm;
+        return vm;
+    }
+
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the default VM
+    ///
+    /// \return Default VM
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static HSQUIRRELVM Get() {
+        return staticVm();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets the default VM to a given VM
+    ///
+    /// \param vm New default VM
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void Set(HSQUIRRELVM vm) {
+        staticVm() = vm;
+    }
+};
+
+/// @cond DEV
+
+class BindingSet;
+
+// Number of Squirrel classes extending native classes whose nearest native base the data of a VM remembers
+#if !defined (SCRAT_NATIVE_CLASS_CACHE_SIZE)
+#define SCRAT_NATIVE_CLASS_CACHE_SIZE 64
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Data Sqrat keeps for every VM so that hot paths can reach it without searching the registry table
+///
+/// \remarks
+/// The data is owned by the registry table of the VM (and is thus shared with all of its threads). It is stored under a
+/// constant user pointer key so that finding it is a single table lookup that hashes no string. Sqrat leaves the foreign
+/// pointer of the VM alone unless SCRAT_VM_DATA_IN_FOREIGN_PTR is defined: then the data is also cached in the foreign
+/// pointer of every VM that uses it, which skips the lookup but reserves the foreign pointer of those VMs for Sqrat.
+/// Compile with SCRAT_NO_VM_DATA defined to not use the data at all.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class VMData {
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the data of a VM if it has already been attached to the VM
+    ///
+    /// \param vm Target VM
+    ///
+    /// \return Data of the VM (or NULL if not attached yet)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static VMData* Get(HSQUIRRELVM vm) {
+#if !defined (SCRAT_NO_VM_DATA)
+#if defined (SCRAT_VM_DATA_IN_FOREIGN_PTR)
+        VMData* cached = static_cast<VMData*>(sq_getforeignptr(vm));
+        if (cached != NULL && cached->tag == TAG) { // the tag tells the data apart from a pointer set by someone else
+            return cached;
+        }
+#endif
+        return Lookup(vm);
+#else
+        SQUNUSED(vm);
+        return NULL;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the data of a VM, creating it and attaching it to the VM if needed
+    ///
+    /// \param vm Target VM
+    ///
+    /// \return Data of the VM (or NULL if compiled with SCRAT_NO_VM_DATA)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static VMData* Attach(HSQUIRRELVM vm) {
+#if !defined (SCRAT_NO_VM_DATA)
+        VMData* data = Get(vm);
+        if (data == NULL) {
+            sq_pushregistrytable(vm);
+            sq_pushuserpointer(vm, RegistryKey());
+            VMData** ud = reinterpret_cast<VMData**>(sq_newuserdata(vm, sizeof(VMData*)));
+            *ud = data = new VMData(vm);
+            sq_setreleasehook(vm, -1, &cleanup_hook);
+            sq_rawset(vm, -3);
+            sq_pop(vm, 1);
+        }
+#if defined (SCRAT_VM_DATA_IN_FOREIGN_PTR)
+        SQUserPointer foreign = sq_getforeignptr(vm);
+        if (foreign == NULL) {
+            sq_setforeignptr(vm, data);
+        } else {
+            assert(foreign == data); // fails because the foreign pointer is used by someone else (see SCRAT_VM_DATA_IN_FOREIGN_PTR)
+        }
+#endif
+        return data;
+#else
+        SQUNUSED(vm);
+        return NULL;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Pushes a constant key, reusing the string interned the first time the key was pushed in the VM
+    ///
+    /// \param vm   Target VM
+    /// \param data Data of the VM the caller already has at hand (the key is simply pushed if NULL)
+    /// \param key  A string literal (the cache is keyed by its address, so it must never be a temporary buffer)
+    ///
+    /// \remarks
+    /// Only worth it when the data is already at hand: looking it up just to push a key costs more than hashing the key.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void PushKey(HSQUIRRELVM vm, VMData* data, const SQChar* key) {
+        if (data != NULL) {
+            HSQOBJECT* cached = data->keys.Find(key);
+            if (cached != NULL) {
+                sq_pushobject(vm, *cached);
+                return;
+            }
+        }
+        sq_pushstring(vm, key, -1);
+        if (data != NULL) {
+            HSQOBJECT obj;
+            sq_getstackobj(vm, -1, &obj);
+            sq_addref(vm, &obj); // released with the other references of the VM when it is closed
+            data->keys[key] = obj;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the class data cached in a slot (see ClassType::getClassSlot)
+    ///
+    /// \param slot Slot of the class
+    ///
+    /// \return The cached class data (or NULL if nothing was cached in the slot yet)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void* GetClassData(unsigned int slot) const {
+        return (slot < classData.size()) ? classData[slot] : NULL;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Caches class data in a slot (see ClassType::getClassSlot)
+    ///
+    /// \param slot Slot of the class
+    /// \param cd   The class data
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetClassData(unsigned int slot, void* cd) {
+        if (slot >= classData.size()) {
+            classData.resize(slot + 1, NULL);
+        }
+        classData[slot] = cd;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Finds the native class data cached for a Squirrel class (see SetNativeClassData)
+    ///
+    /// \param cls The Squirrel class
+    ///
+    /// \return Pointer to the cached class data (which is NULL for classes that extend no native class),
+    ///         or NULL if nothing was cached for the class yet
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void** FindNativeClassData(const HSQOBJECT& cls) {
+        return nativeClassData.Find(cls._unVal.pClass);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Caches the static class data of the nearest native base of a Squirrel class, which has no type tag of its own
+    ///
+    /// \param vm  Target VM
+    /// \param cls The Squirrel class (kept alive while it is cached so that its address is never reused)
+    /// \param cd  The class data (NULL if the class extends no native class)
+    ///
+    /// \remarks
+    /// At most SCRAT_NATIVE_CLASS_CACHE_SIZE classes are cached: once full, the cache is emptied and its classes released
+    /// so that scripts creating classes on the fly do not keep every one of them alive.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetNativeClassData(HSQUIRRELVM vm, HSQOBJECT cls, void* cd) {
+        if (nativeClasses.size() >= SCRAT_NATIVE_CLASS_CACHE_SIZE) {
+            for (size_t i = 0; i < nativeClasses.size(); ++i) {
+                sq_release(vm, &nativeClasses[i]);
+            }
+            nativeClasses.clear();
+            nativeClassData = PointerMap<SQClass*, void*>();
+        }
+        sq_addref(vm, &cls); // the classes still cached are released with the other references of the VM when it is closed
+        nativeClasses.push_back(cls);
+        nativeClassData[cls._unVal.pClass] = cd;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the object that owns the VM (like the SqratVM that created it)
+    ///
+    /// \return The owner (or NULL if none was set)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void* GetOwner() const {
+        return owner;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets the object that owns the VM
+    ///
+    /// \param o The owner (or NULL)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetOwner(void* o) {
+        owner = o;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the BindingSet recording the bindings made in the VM
+    ///
+    /// \return The BindingSet (or NULL if the VM is not being recorded)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BindingSet* GetRecorder() const {
+        return recorder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Sets the BindingSet recording the bindings made in the VM (see BindingSet::Record)
+    ///
+    /// \param r The BindingSet (or NULL to stop recording)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetRecorder(BindingSet* r) {
+        recorder = r;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Returns whether a Sqrat error is pending in the VM (see Sqrat::Error)
+    ///
+    /// \return True if an error is pending, otherwise false
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool HasError() const {
+        return hasError;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the message of the pending error
+    ///
+    /// \return The message (empty if no error is pending)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const string& GetError() const {
+        return error;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Makes an error pending unless one already is (the first error is the one reported)
+    ///
+    /// \param err A nice error message
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetError(const string& err) {
+        if (!hasError) {
+            hasError = true;
+            error = err;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Clears the pending error
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void ClearError() {
+        hasError = false;
+        error.clear();
+    }
+
+private:
+
+    static const unsigned int TAG = 0x53717274; // "Sqrt"
+
+    VMData(HSQUIRRELVM v) : tag(TAG), vm(v), owner(NULL), recorder(NULL), hasError(false) {}
+
+    // A user pointer rather than a string so that looking the data up needs no string to be hashed and interned
+    static SQUserPointer RegistryKey() {
+        return reinterpret_cast<SQUserPointer>(static_cast<size_t>(TAG));
+    }
+
+    static VMData* Lookup(HSQUIRRELVM vm) {
+        VMData* data = NULL;
+        sq_pushregistrytable(vm);
+        sq_pushuserpointer(vm, RegistryKey());
+        if (SQ_SUCCEEDED(sq_rawget(vm, -2))) { // this or another thread of the same VM created it already
+            VMData** ud;
+            sq_getuserdata(vm, -1, (SQUserPointer*)&ud, NULL);
+            data = *ud;
+            sq_pop(vm, 1);
+        }
+        sq_pop(vm, 1);
+        return data;
+    }
+
+    static SQInteger cleanup_hook(SQUserPointer ptr, SQInteger size) {
+        SQUNUSED(size);
+        VMData** ud = reinterpret_cast<VMData**>(ptr);
+#if defined (SCRAT_VM_DATA_IN_FOREIGN_PTR)
+        // The VM that created the data is still alive while its registry table is released (threads may not be,
+        // but they are released along with the VM and can no longer be used anyway)
+        if (sq_getforeignptr((*ud)->vm) == *ud) {
+            sq_setforeignptr((*ud)->vm, NULL);
+        }
+#endif
+        delete *ud;
+        *ud = NULL; // release hooks that run later find no data instead of a dangling one
+        return 0;
+    }
+
+    unsigned int                        tag; // TAG while the data is alive
+    HSQUIRRELVM                         vm;
+    std::vector<void*>                  classData;
+    PointerMap<const SQChar*, HSQOBJECT> keys;
+    PointerMap<SQClass*, void*>         nativeClassData;
+    std::vector<HSQOBJECT>              nativeClasses; // the classes in nativeClassData, kept alive while cached
+    void*                               owner;
+    BindingSet*                         recorder;
+    bool                                hasError;
+    string                              error;
+};
+
+/// @endcond
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// A slot name interned once so it can be used to look up slots repeatedly without hashing the string again
+///
+/// \remarks
+/// Key can be given to Object::GetSlot, Object::HasKey, TableBase::GetValue, TableBase::GetFunction and
+/// Class::GetFunction instead of a string. Keep the Key around (for example as a member or a static) and reuse it.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class Key {
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Constructs a Key
+    ///
+    /// \param name Name of the slot
+    /// \param v    VM that the Key will be used with
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Key(const SQChar* name, HSQUIRRELVM v = DefaultVM::Get()) : vm(v) {
+        sq_pushstring(vm, name, -1);
+        sq_getstackobj(vm, -1, &obj);
+        sq_addref(vm, &obj);
+        sq_pop(vm, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Copy constructor
+    ///
+    /// \param k Key to copy
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Key(const Key& k) : vm(k.vm), obj(k.obj) {
+        sq_addref(vm, &obj);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Destructor
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ~Key() {
+        sq_release(vm, &obj);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Assignment operator
+    ///
+    /// \param k Key to copy
+    ///
+    /// \return The Key itself
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Key& operator=(const Key& k) {
+        HSQOBJECT oldObj = obj;
+        HSQUIRRELVM oldVm = vm;
+        vm = k.vm;
+        obj = k.obj;
+        sq_addref(vm, &obj);
+        sq_release(oldVm, &oldObj);
+        return *this;
+    }
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/// Helper class that defines a VM that can be used as a fallback VM in case no other one is given to a piece of code
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class DefaultVM {
-private:
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the interned string of the Key
+    ///
+    /// \return Squirrel object of the Key
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const HSQOBJECT& GetObject() const {
+        return obj;
+    }
 
-    static HSQUIRRELVM& staticVm() {
-        static HSQUIRRELVM vm;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the VM of the Key
+    ///
+    /// \return VM the Key was created for
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    HSQUIRRELVM GetVM() const {
         return vm;
     }
 
-public:
-
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Gets the default VM
+    /// Gets the name of the Key
     ///
-    /// \return Default VM
+    /// \return Name of the slot (stays valid as long as the Key is alive)
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    static HSQUIRRELVM Get() {
-        return staticVm();
+    const SQChar* GetName() const {
+        return sq_objtostring(&obj);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// Sets the default VM to a given VM
+    /// Pushes the Key onto the stack of a VM
     ///
-    /// \param vm New default VM
+    /// \param v VM to push onto (must share the strings of the VM of the Key, like its threads do)
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    static void Set(HSQUIRRELVM vm) {
-        staticVm() = vm;
+    void Push(HSQUIRRELVM v) const {
+        sq_pushobject(v, obj);
     }
+
+private:
+
+    HSQUIRRELVM vm;
+    HSQOBJECT   obj;
 };
 
 #if !defined (SCRAT_NO_ERROR_CHECKING) && !defined (SCRAT_USE_EXCEPTIONS)
@@ -256,10 +933,14 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static void Clear(HSQUIRRELVM vm) {
+#if !defined (SCRAT_NO_VM_DATA)
+        Data(vm)->ClearError();
+#else
         sq_pushregistrytable(vm);
         sq_pushstring(vm, "__error", -1);
         sq_rawdeleteslot(vm, -2, false);
         sq_pop(vm, 1);
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +952,15 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static string Message(HSQUIRRELVM vm) {
+#if !defined (SCRAT_NO_VM_DATA)
+        VMData* vd = Data(vm);
+        if (vd->HasError()) {
+            string err = vd->GetError();
+            vd->ClearError();
+            return err;
+        }
+        return string(_SC("an unknown error has occurred"));
+#else
         sq_pushregistrytable(vm);
         sq_pushstring(vm, "__error", -1);
         if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
@@ -287,6 +977,7 @@ public:
         sq_rawdeleteslot(vm, -2, false);
         sq_pop(vm, 1);
         return string(_SC("an unknown error has occurred"));
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +989,9 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static bool Occurred(HSQUIRRELVM vm) {
+#if !defined (SCRAT_NO_VM_DATA)
+        return Data(vm)->HasError();
+#else
         sq_pushregistrytable(vm);
         sq_pushstring(vm, "__error", -1);
         if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
@@ -306,6 +1000,7 @@ public:
         }
         sq_pop(vm, 1);
         return false;
+#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +1011,9 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     static void Throw(HSQUIRRELVM vm, const string& err) {
+#if !defined (SCRAT_NO_VM_DATA)
+        Data(vm)->SetError(err);
+#else
         sq_pushregistrytable(vm);
         sq_pushstring(vm, "__error", -1);
         if (SQ_FAILED(sq_rawget(vm, -2))) {
@@ -328,18 +1026,28 @@ public:
             return;
         }
         sq_pop(vm, 2);
+#endif
     }
 
 private:
 
     Error() {}
 
+#if !defined (SCRAT_NO_VM_DATA)
+    // The error lives in the data of the VM. Reaching it is a registry lookup under a user pointer key, which hashes
+    // no string unlike the "__error" key it replaces (with SCRAT_VM_DATA_IN_FOREIGN_PTR it is a pointer read). Threads
+    // of a VM share its data, just as they used to share the error stored in the registry table
+    static VMData* Data(HSQUIRRELVM vm) {
+        return VMData::Attach(vm);
+    }
+#else
     static SQInteger error_cleanup_hook(SQUserPointer ptr, SQInteger size) {
         SQUNUSED(size);
         string** ud = reinterpret_cast<string**>(ptr);
         delete *ud;
         return 0;
     }
+#endif
 };
 #endif
 
@@ -471,6 +1179,291 @@ inline string LastErrorString(HSQUIRRELVM vm) {
     return string(sqErr);
 }
 
+/// @cond DEV
+
+// Reference count of SharedPtr (atomic if compiled with SCRAT_USE_ATOMIC_REFCOUNTS so SharedPtr can be shared between threads)
+class RefCount {
+public:
+
+    RefCount(unsigned int n) : m_Count(n) {}
+
+#if !defined(SCRAT_USE_ATOMIC_REFCOUNTS)
+
+    unsigned int Get() const       { return m_Count; }
+    unsigned int Increment()       { return ++m_Count; }
+    unsigned int Decrement()       { return --m_Count; }
+    bool         IncrementIfNotZero() {
+        if (m_Count == 0) {
+            return false;
+        }
+        ++m_Count;
+        return true;
+    }
+
+private:
+    unsigned int m_Count;
+
+#elif defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+    unsigned int Get() const       { return m_Count.load(); }
+    unsigned int Increment()       { return ++m_Count; }
+    unsigned int Decrement()       { return --m_Count; }
+    bool         IncrementIfNotZero() {
+        unsigned int n = m_Count.load();
+        while (n != 0) {
+            if (m_Count.compare_exchange_weak(n, n + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::atomic<unsigned int> m_Count;
+
+#elif defined(_MSC_VER)
+
+    unsigned int Get() const       { return static_cast<unsigned int>(_InterlockedCompareExchange(const_cast<volatile long*>(&m_Count), 0, 0)); }
+    unsigned int Increment()       { return static_cast<unsigned int>(_InterlockedIncrement(&m_Count)); }
+    unsigned int Decrement()       { return static_cast<unsigned int>(_InterlockedDecrement(&m_Count)); }
+    bool         IncrementIfNotZero() {
+        long n = m_Count;
+        while (n != 0) {
+            long seen = _InterlockedCompareExchange(&m_Count, n + 1, n);
+            if (seen == n) {
+                return true;
+            }
+            n = seen;
+        }
+        return false;
+    }
+
+private:
+    volatile long m_Count;
+
+#else // GCC and Clang
+
+    unsigned int Get() const       { return __sync_add_and_fetch(const_cast<volatile unsigned int*>(&m_Count), 0); }
+    unsigned int Increment()       { return __sync_add_and_fetch(&m_Count, 1); }
+    unsigned int Decrement()       { return __sync_sub_and_fetch(&m_Count, 1); }
+    bool         IncrementIfNotZero() {
+        unsigned int n = m_Count;
+        while (n != 0) {
+            unsigned int seen = __sync_val_compare_and_swap(&m_Count, n, n + 1);
+            if (seen == n) {
+                return true;
+            }
+            n = seen;
+        }
+        return false;
+    }
+
+private:
+    volatile unsigned int m_Count;
+
+#endif
+
+    RefCount(const RefCount&);
+    RefCount& operator=(const RefCount&);
+};
+
+// Spin lock for short critical sections that are rarely contended (like registering a bound class)
+// Has no constructor so a zero initialized static is unlocked before any constructor runs
+// Waiting threads pause the CPU between attempts and, after a few attempts, give their time slice to the holder
+class SpinLock {
+public:
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+    void Lock() {
+        for (unsigned int spins = 0; m_Locked.exchange(1, std::memory_order_acquire) != 0; ++spins) {
+            Backoff(spins);
+        }
+    }
+    void Unlock() {
+        m_Locked.store(0, std::memory_order_release);
+    }
+
+private:
+    std::atomic<int> m_Locked;
+
+#elif defined(_MSC_VER)
+
+    void Lock() {
+        for (unsigned int spins = 0; _InterlockedExchange(&m_Locked, 1) != 0; ++spins) {
+            Backoff(spins);
+        }
+    }
+    void Unlock() {
+        _InterlockedExchange(&m_Locked, 0);
+    }
+
+private:
+    volatile long m_Locked;
+
+#else // GCC and Clang
+
+    void Lock() {
+        for (unsigned int spins = 0; __sync_lock_test_and_set(&m_Locked, 1) != 0; ++spins) {
+            Backoff(spins);
+        }
+    }
+    void Unlock() {
+        __sync_lock_release(&m_Locked);
+    }
+
+private:
+    volatile int m_Locked;
+
+#endif
+
+    static void Backoff(unsigned int spins) {
+        if (spins < 16) {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+            __yield();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+            __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__arm__) || defined(__aarch64__))
+            __asm__ __volatile__("yield");
+#endif
+            return;
+        }
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+        std::this_thread::yield();
+#elif defined(_WIN32)
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    }
+};
+
+// Holds a SpinLock for the lifetime of the guard
+class SpinLockGuard {
+public:
+    SpinLockGuard(SpinLock& lock) : m_Lock(lock) {
+        m_Lock.Lock();
+    }
+    ~SpinLockGuard() {
+        m_Lock.Unlock();
+    }
+
+private:
+    SpinLock& m_Lock;
+
+    SpinLockGuard(const SpinLockGuard&);
+    SpinLockGuard& operator=(const SpinLockGuard&);
+};
+
+// Pointer published by one thread and read by others without a lock (stores release, loads acquire)
+// Has no constructor so a zero initialized static holds NULL before any constructor runs
+template<class T>
+class AtomicPtr {
+public:
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+    T*   Load() const  { return m_Ptr.load(std::memory_order_acquire); }
+    void Store(T* ptr) { m_Ptr.store(ptr, std::memory_order_release); }
+
+private:
+    std::atomic<T*> m_Ptr;
+
+#elif defined(_MSC_VER)
+
+    T*   Load() const  { T* ptr = m_Ptr; _ReadWriteBarrier(); return ptr; } // volatile accesses have acquire and release semantics in MSVC
+    void Store(T* ptr) { _ReadWriteBarrier(); m_Ptr = ptr; }
+
+private:
+    T* volatile m_Ptr;
+
+#else // GCC and Clang
+
+    T*   Load() const  { return __atomic_load_n(&m_Ptr, __ATOMIC_ACQUIRE); }
+    void Store(T* ptr) { __atomic_store_n(&m_Ptr, ptr, __ATOMIC_RELEASE); }
+
+private:
+    T* m_Ptr;
+
+#endif
+};
+
+// Control block shared by the SharedPtr and WeakPtr of an object (one allocation instead of one per count)
+struct SharedCounts {
+    RefCount strong;  // SharedPtr owning the object
+    RefCount total;   // SharedPtr and WeakPtr using this block
+    bool     inplace; // the object lives in the same allocation, right after the block (see MakeShared)
+
+    SharedCounts(bool i) : strong(1), total(1), inplace(i) {}
+
+    void Free() {
+        if (inplace) {
+            this->~SharedCounts();
+            ::operator delete(this);
+        } else {
+            delete this;
+        }
+    }
+};
+
+// Lays out the single allocation made by MakeShared: the control block followed by the object
+template <class T>
+class SharedBlock {
+public:
+
+    static void* Allocate() {
+        return ::operator new(HeaderSize() + sizeof(T));
+    }
+
+    static void* ObjectStorage(void* block) {
+        return static_cast<char*>(block) + HeaderSize();
+    }
+
+    static SharedPtr<T> Adopt(void* block, T* object) {
+        return SharedPtr<T>(object, new (block) SharedCounts(true));
+    }
+
+    // Owns a new block until the object is constructed in it, so the block is freed if the constructor throws
+    class Guard {
+    public:
+        Guard() : block(Allocate()) {}
+        ~Guard() {
+            if (block != NULL) {
+                ::operator delete(block);
+            }
+        }
+        void* Storage() const {
+            return ObjectStorage(block);
+        }
+        SharedPtr<T> Adopt(T* object) {
+            void* adopted = block;
+            block = NULL;
+            return SharedBlock<T>::Adopt(adopted, object);
+        }
+    private:
+        void* block;
+        Guard(const Guard&);
+        Guard& operator=(const Guard&);
+    };
+
+private:
+
+    union MaxAlign {
+        long double ld;
+        double      d;
+        void*       p;
+        long        l;
+    };
+
+    static size_t HeaderSize() {
+        return (sizeof(SharedCounts) + sizeof(MaxAlign) - 1) / sizeof(MaxAlign) * sizeof(MaxAlign);
+    }
+};
+
+/// @endcond
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// A smart pointer that retains shared ownership of an object through a pointer (see std::shared_ptr)
 ///
@@ -482,6 +1475,10 @@ inline string LastErrorString(HSQUIRRELVM vm) {
 /// \remarks
 /// std::shared_ptr was not used because it is a C++11 feature.
 ///
+/// \remarks
+/// Create objects with MakeShared when possible: the object and its reference counts then share one allocation.
+/// The reference counts are only safe to change from several threads if compiling with SCRAT_USE_ATOMIC_REFCOUNTS defined.
+///
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <class T>
 class SharedPtr
@@ -492,11 +1489,19 @@ class SharedPtr
     template <class U>
     friend class WeakPtr;
 
+    friend class SharedBlock<T>;
+
 private:
 
     T*            m_Ptr;
-    unsigned int* m_RefCount;
-    unsigned int* m_RefCountRefCount;
+    SharedCounts* m_Counts;
+
+    SharedPtr(T* ptr, SharedCounts* counts) :
+    m_Ptr   (ptr),
+    m_Counts(counts)
+    {
+
+    }
 
 public:
 
@@ -505,9 +1510,8 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     SharedPtr() :
-    m_Ptr             (NULL),
-    m_RefCount        (NULL),
-    m_RefCountRefCount(NULL)
+    m_Ptr   (NULL),
+    m_Counts(NULL)
     {
 
     }
@@ -519,9 +1523,8 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     SharedPtr(T* ptr) :
-    m_Ptr             (NULL),
-    m_RefCount        (NULL),
-    m_RefCountRefCount(NULL)
+    m_Ptr   (NULL),
+    m_Counts(NULL)
     {
         Init(ptr);
     }
@@ -536,9 +1539,8 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     template <class U>
     SharedPtr(U* ptr) :
-    m_Ptr             (NULL),
-    m_RefCount        (NULL),
-    m_RefCountRefCount(NULL)
+    m_Ptr   (NULL),
+    m_Counts(NULL)
     {
         Init(ptr);
     }
@@ -554,17 +1556,15 @@ public:
         if (copy.Get() != NULL)
         {
             m_Ptr              = copy.Get();
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCount         += 1;
-            *m_RefCountRefCount += 1;
+            m_Counts->strong.Increment();
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -582,17 +1582,15 @@ public:
         if (copy.Get() != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.Get());
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCount         += 1;
-            *m_RefCountRefCount += 1;
+            m_Counts->strong.Increment();
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -610,17 +1608,15 @@ public:
         if (copy.m_Ptr != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.m_Ptr);
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCount         += 1;
-            *m_RefCountRefCount += 1;
+            m_Counts->strong.Increment();
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -650,11 +1646,10 @@ public:
             if (copy.Get() != NULL)
             {
                 m_Ptr              = copy.Get();
-                m_RefCount         = copy.m_RefCount;
-                m_RefCountRefCount = copy.m_RefCountRefCount;
+                m_Counts           = copy.m_Counts;
 
-                *m_RefCount         += 1;
-                *m_RefCountRefCount += 1;
+                m_Counts->strong.Increment();
+                m_Counts->total.Increment();
             }
         }
 
@@ -679,11 +1674,10 @@ public:
         if (copy.Get() != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.Get());
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCount         += 1;
-            *m_RefCountRefCount += 1;
+            m_Counts->strong.Increment();
+            m_Counts->total.Increment();
         }
 
         return *this;
@@ -699,13 +1693,11 @@ public:
     {
         Reset();
 
-        m_Ptr = ptr;
-
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
-
-        m_RefCountRefCount = new unsigned int;
-        *m_RefCountRefCount = 1;
+        if (ptr != NULL)
+        {
+            m_Ptr    = ptr;
+            m_Counts = new SharedCounts(false);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -721,13 +1713,11 @@ public:
     {
         Reset();
 
-        m_Ptr = static_cast<T*>(ptr);
-
-        m_RefCount = new unsigned int;
-        *m_RefCount = 1;
-
-        m_RefCountRefCount = new unsigned int;
-        *m_RefCountRefCount = 1;
+        if (ptr != NULL)
+        {
+            m_Ptr    = static_cast<T*>(ptr);
+            m_Counts = new SharedCounts(false);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -738,23 +1728,25 @@ public:
     {
         if (m_Ptr != NULL)
         {
-            *m_RefCount         -= 1;
-            *m_RefCountRefCount -= 1;
-
-            if (*m_RefCount == 0)
+            if (m_Counts->strong.Decrement() == 0)
             {
-                delete m_Ptr;
+                if (m_Counts->inplace)
+                {
+                    m_Ptr->~T();
+                }
+                else
+                {
+                    delete m_Ptr;
+                }
             }
 
-            if (*m_RefCountRefCount == 0)
+            if (m_Counts->total.Decrement() == 0)
             {
-                delete m_RefCount;
-                delete m_RefCountRefCount;
+                m_Counts->Free();
             }
 
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -913,6 +1905,155 @@ public:
     }
 };
 
+#if !defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \tparam T Type of the object
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T>
+SharedPtr<T> MakeShared() {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T();
+    return block.Adopt(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a1 Argument 1 of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A1 Type of argument 1 of the constructor (usually doesnt need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class A1>
+SharedPtr<T> MakeShared(const A1& a1) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(a1);
+    return block.Adopt(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a1 Argument 1 of the constructor of T
+/// \param a2 Argument 2 of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A1 Type of argument 1 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A2 Type of argument 2 of the constructor (usually doesnt need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class A1, class A2>
+SharedPtr<T> MakeShared(const A1& a1, const A2& a2) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(a1, a2);
+    return block.Adopt(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a1 Argument 1 of the constructor of T
+/// \param a2 Argument 2 of the constructor of T
+/// \param a3 Argument 3 of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A1 Type of argument 1 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A2 Type of argument 2 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A3 Type of argument 3 of the constructor (usually doesnt need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class A1, class A2, class A3>
+SharedPtr<T> MakeShared(const A1& a1, const A2& a2, const A3& a3) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(a1, a2, a3);
+    return block.Adopt(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a1 Argument 1 of the constructor of T
+/// \param a2 Argument 2 of the constructor of T
+/// \param a3 Argument 3 of the constructor of T
+/// \param a4 Argument 4 of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A1 Type of argument 1 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A2 Type of argument 2 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A3 Type of argument 3 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A4 Type of argument 4 of the constructor (usually doesnt need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class A1, class A2, class A3, class A4>
+SharedPtr<T> MakeShared(const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(a1, a2, a3, a4);
+    return block.Adopt(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a1 Argument 1 of the constructor of T
+/// \param a2 Argument 2 of the constructor of T
+/// \param a3 Argument 3 of the constructor of T
+/// \param a4 Argument 4 of the constructor of T
+/// \param a5 Argument 5 of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A1 Type of argument 1 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A2 Type of argument 2 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A3 Type of argument 3 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A4 Type of argument 4 of the constructor (usually doesnt need to be defined explicitly)
+/// \tparam A5 Type of argument 5 of the constructor (usually doesnt need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class A1, class A2, class A3, class A4, class A5>
+SharedPtr<T> MakeShared(const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(a1, a2, a3, a4, a5);
+    return block.Adopt(object);
+}
+
+#else // SCRAT_USE_CXX11_OPTIMIZATIONS
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Creates an object and the SharedPtr owning it with a single allocation (see std::make_shared)
+///
+/// \param a Arguments of the constructor of T
+///
+/// \tparam T Type of the object
+/// \tparam A Types of the arguments of the constructor (usually dont need to be defined explicitly)
+///
+/// \return SharedPtr owning the new object
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <class T, class... A>
+SharedPtr<T> MakeShared(A&&... a) {
+    typename SharedBlock<T>::Guard block;
+    T* object = new (block.Storage()) T(std::forward<A>(a)...);
+    return block.Adopt(object);
+}
+
+#endif // SCRAT_USE_CXX11_OPTIMIZATIONS
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// A smart pointer that retains a non-owning ("weak") reference to an object that is managed by SharedPtr (see std::weak_ptr)
 ///
@@ -934,8 +2075,7 @@ class WeakPtr
 private:
 
     T*            m_Ptr;
-    unsigned int* m_RefCount;
-    unsigned int* m_RefCountRefCount;
+    SharedCounts* m_Counts;
 
 public:
 
@@ -944,9 +2084,8 @@ public:
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     WeakPtr() :
-    m_Ptr             (NULL),
-    m_RefCount        (NULL),
-    m_RefCountRefCount(NULL)
+    m_Ptr   (NULL),
+    m_Counts(NULL)
     {
 
     }
@@ -962,16 +2101,14 @@ public:
         if (copy.m_Ptr != NULL)
         {
             m_Ptr              = copy.m_Ptr;
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -989,16 +2126,14 @@ public:
         if (copy.m_Ptr != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.m_Ptr);
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -1016,16 +2151,14 @@ public:
         if (copy.Get() != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.Get());
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
         else
         {
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 
@@ -1055,10 +2188,9 @@ public:
             if (copy.m_Ptr != NULL)
             {
                 m_Ptr              = copy.m_Ptr;
-                m_RefCount         = copy.m_RefCount;
-                m_RefCountRefCount = copy.m_RefCountRefCount;
+                m_Counts           = copy.m_Counts;
 
-                *m_RefCountRefCount += 1;
+                m_Counts->total.Increment();
             }
         }
 
@@ -1083,10 +2215,9 @@ public:
         if (copy.m_Ptr != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.m_Ptr);
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
 
         return *this;
@@ -1110,10 +2241,9 @@ public:
         if (copy.Get() != NULL)
         {
             m_Ptr              = static_cast<T*>(copy.Get());
-            m_RefCount         = copy.m_RefCount;
-            m_RefCountRefCount = copy.m_RefCountRefCount;
+            m_Counts           = copy.m_Counts;
 
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
 
         return *this;
@@ -1127,7 +2257,7 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     bool Expired() const
     {
-        return (m_Ptr == NULL || *m_RefCount == 0);
+        return (m_Ptr == NULL || m_Counts->strong.Get() == 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1139,14 +2269,12 @@ public:
     SharedPtr<T> Lock() const
     {
         SharedPtr<T> other;
-        if (m_Ptr != NULL)
+        if (m_Ptr != NULL && m_Counts->strong.IncrementIfNotZero())
         {
-            other.m_Ptr              = m_Ptr;
-            other.m_RefCount         = m_RefCount;
-            other.m_RefCountRefCount = m_RefCountRefCount;
+            other.m_Ptr    = m_Ptr;
+            other.m_Counts = m_Counts;
 
-            *m_RefCount         += 1;
-            *m_RefCountRefCount += 1;
+            m_Counts->total.Increment();
         }
         return other;
     }
@@ -1159,17 +2287,13 @@ public:
     {
         if (m_Ptr != NULL)
         {
-            *m_RefCountRefCount -= 1;
-
-            if (*m_RefCountRefCount == 0)
+            if (m_Counts->total.Decrement() == 0)
             {
-                delete m_RefCount;
-                delete m_RefCountRefCount;
+                m_Counts->Free();
             }
 
             m_Ptr              = NULL;
-            m_RefCount         = NULL;
-            m_RefCountRefCount = NULL;
+            m_Counts           = NULL;
         }
     }
 };
@@ -34,6 +34,7 @@
 #include <iostream>
 #include <stdarg.h>
 #include <stdio.h>
+#include <vector>
 
 #include <sqstdio.h>
 #include <sqstdblob.h>
@@ -54,7 +55,10 @@ namespace Sqrat
 /// Helper class that wraps a Squirrel virtual machine in a C++ API
 ///
 /// \remarks
-/// This class is not currently thread-safe for the case of different VMs running in different threads (all others are)
+/// Different SqratVM can be created, used and destroyed in different threads (a single SqratVM is not thread-safe).
+/// The SqratVM of a VM is found through the VM data (see VMData) so error handlers do not search the registry of SqratVM
+/// nor take its lock. That costs one registry table lookup under a user pointer key (no string is hashed), or a read of
+/// the foreign pointer if SCRAT_VM_DATA_IN_FOREIGN_PTR is defined.
 ///
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class SqratVM
@@ -68,25 +72,41 @@ private:
 
     static void s_addVM(HSQUIRRELVM vm, SqratVM* sqratvm)
     {
-        // TODO for user: use mutex to lock ms_sqratVMs if necessary for your uses
+        VMData* vd = VMData::Attach(vm);
+        if (vd != NULL) {
+            vd->SetOwner(sqratvm);
+        }
+        SpinLockGuard guard(ms_lock());
         ms_sqratVMs().insert(std::make_pair(vm, sqratvm));
     }
 
     static void s_deleteVM(HSQUIRRELVM vm)
     {
-        // TODO for user: use mutex to lock ms_sqratVMs if necessary for your uses
+        VMData* vd = VMData::Get(vm);
+        if (vd != NULL) {
+            vd->SetOwner(NULL);
+        }
+        SpinLockGuard guard(ms_lock());
         ms_sqratVMs().erase(vm);
     }
 
     static SqratVM* s_getVM(HSQUIRRELVM vm)
     {
-        // TODO for user: use mutex to lock ms_sqratVMs if necessary for your uses
-        return ms_sqratVMs()[vm];
+#if !defined (SCRAT_NO_VM_DATA)
+        VMData* vd = VMData::Get(vm); // also finds the data of the threads of the VM
+        return (vd != NULL) ? static_cast<SqratVM*>(vd->GetOwner()) : NULL;
+#else
+        SpinLockGuard guard(ms_lock());
+        unordered_map<HSQUIRRELVM, SqratVM*>::type::iterator it = ms_sqratVMs().find(vm);
+        return (it != ms_sqratVMs().end()) ? it->second : NULL;
+#endif
     }
 
 private:
 
+    // The registry of SqratVM is only used on creation, destruction and enumeration, always with ms_lock held
     static SQRAT_API unordered_map<HSQUIRRELVM, SqratVM*>::type& ms_sqratVMs();
+    static SQRAT_API SpinLock& ms_lock();
 
     static void printFunc(HSQUIRRELVM /*v*/, const SQChar *s, ...)
     {
@@ -188,6 +208,40 @@ public:
         sq_close(m_vm);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the SqratVM that created a VM
+    ///
+    /// \param vm Target VM (or one of its threads)
+    ///
+    /// \return The SqratVM (or NULL if the VM was not created by a SqratVM)
+    ///
+    /// \remarks
+    /// Costs one registry table lookup under a user pointer key (a pointer read with SCRAT_VM_DATA_IN_FOREIGN_PTR defined),
+    /// or a search of the registry of SqratVM under its lock with SCRAT_NO_VM_DATA defined.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static SqratVM* Get(HSQUIRRELVM vm)
+    {
+        return s_getVM(vm);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets every SqratVM alive at the time of the call
+    ///
+    /// \return The SqratVM (the caller must make sure none is destroyed while it uses them)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static std::vector<SqratVM*> GetAll()
+    {
+        std::vector<SqratVM*> vms;
+        SpinLockGuard guard(ms_lock());
+        vms.reserve(ms_sqratVMs().size());
+        for (unordered_map<HSQUIRRELVM, SqratVM*>::type::const_iterator it = ms_sqratVMs().begin(); it != ms_sqratVMs().end(); ++it) {
+            vms.push_back(it->second);
+        }
+        return vms;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// Gets the underlying Squirrel VM
     ///
@@ -338,9 +392,14 @@ public:
 
 #if !defined(SCRAT_IMPORT)
 inline unordered_map<HSQUIRRELVM, SqratVM*>::type& SqratVM::ms_sqratVMs() {
-    static unordered_map<HSQUIRRELVM, SqratVM*>::type ms;
+    static unordered_map<HSQUIRRELVM, SqratVM*>::type ms; // first constructed with ms_lock held
     return ms;
 }
+
+inline SpinLock& SqratVM::ms_lock() {
+    static SpinLock lock; // zero initialized, so it is ready before any thread creates a SqratVM
+    return lock;
+}
 #endif
 
 }
@@ -0,0 +1,343 @@
+//
+// SqratVMPool: Pool of Ready to Use SqratVM
+//
+
+//
+// Copyright (c) 2009 Brandon Jones
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+//    1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+//
+//    2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+//    3. This notice may not be removed or altered from any source
+//    distribution.
+//
+
+#if !defined(_SCRAT_VMPOOL_H_)
+#define _SCRAT_VMPOOL_H_
+
+#include <time.h>
+#include <vector>
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+#include <chrono>
+#elif defined(_WIN32)
+union _LARGE_INTEGER; // same declarations as windows.h, not included for its macros
+extern "C" __declspec(dllimport) int __stdcall QueryPerformanceCounter(union _LARGE_INTEGER* count);
+extern "C" __declspec(dllimport) int __stdcall QueryPerformanceFrequency(union _LARGE_INTEGER* frequency);
+#endif
+
+#include "sqratVM.h"
+
+namespace Sqrat
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Counters describing a SqratVMPool (see SqratVMPool::GetStats)
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct VMPoolStats
+{
+    size_t created;       ///< VMs created by the pool (initially and when the pool was empty)
+    size_t idle;          ///< VMs ready to be acquired
+    size_t inUse;         ///< VMs acquired and not released yet
+    size_t checkouts;     ///< Calls to SqratVMPool::Acquire
+    size_t reuses;        ///< Calls to SqratVMPool::Acquire served with a VM that was used before
+    size_t misses;        ///< Calls to SqratVMPool::Acquire that had to create a VM because the pool was empty
+    double checkoutTime;  ///< Seconds spent in SqratVMPool::Acquire (including creating VMs on misses)
+    double maxCheckout;   ///< Longest single SqratVMPool::Acquire in seconds
+    size_t resets;        ///< VMs reset to their baseline by SqratVMPool::Release
+    double resetTime;     ///< Seconds spent resetting VMs
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Keeps fully initialized SqratVM ready so that creating and binding VMs is kept off the code that needs them
+///
+/// \remarks
+/// Every VM is created with the stack size and libraries given to the pool, then passed to the initialization function
+/// (to bind classes, run bootstrap scripts...). The content of its root table is then saved as its baseline.
+/// SqratVMPool::Release resets a VM to that baseline instead of destroying it: slots added to the root table are removed,
+/// slots that were replaced get their baseline value back, the stack is restored and garbage is collected.
+///
+/// \remarks
+/// Only the root table itself is restored: changes made inside objects it holds (like a static variable of a class or
+/// a table used as a namespace), to the const table or to C++ state are kept. Scripts that need a clean VM for such
+/// state should not share pooled VMs.
+///
+/// \remarks
+/// Acquire and Release can be called from any thread. A VM must only be used by one thread at a time.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SqratVMPool
+{
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Function called on every VM the pool creates, before its baseline is saved
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    typedef void (*INITFUNC)(SqratVM& vm);
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Constructs the pool and creates its VMs
+    ///
+    /// \param size             Number of VMs created up front
+    /// \param init             Function initializing every VM (or NULL)
+    /// \param initialStackSize Initial size of the execution stack of the VMs
+    /// \param libsToLoad       Specifies what standard Squirrel libraries should be loaded in the VMs
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SqratVMPool(size_t size, INITFUNC init = NULL, int initialStackSize = 1024, unsigned char libsToLoad = SqratVM::LIB_ALL)
+        : m_stats()
+        , m_init(init)
+        , m_stackSize(initialStackSize)
+        , m_libs(libsToLoad)
+    {
+        m_lock.Unlock(); // SpinLock has no constructor so that static ones need none
+        m_idle.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_idle.push_back(CreateEntry());
+        }
+        m_stats.created = size;
+        m_stats.idle = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Destructor (destroys the idle VMs, every acquired VM must have been released before)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ~SqratVMPool()
+    {
+        assert(m_stats.inUse == 0); // fails if a VM acquired from the pool was not released
+        for (size_t i = 0; i < m_idle.size(); ++i)
+        {
+            DestroyEntry(m_idle[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Takes a VM from the pool, creating one if the pool is empty
+    ///
+    /// \return A VM in its baseline state (give it back with Release)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SqratVM* Acquire()
+    {
+        double start = Now();
+        Entry* entry = NULL;
+        {
+            SpinLockGuard guard(m_lock);
+            if (!m_idle.empty())
+            {
+                entry = m_idle.back();
+                m_idle.pop_back();
+            }
+        }
+        bool miss = (entry == NULL);
+        if (miss)
+        {
+            entry = CreateEntry();
+        }
+        double elapsed = Now() - start;
+
+        SpinLockGuard guard(m_lock);
+        m_inUse[entry->vm] = entry;
+        m_stats.checkouts += 1;
+        m_stats.checkoutTime += elapsed;
+        if (elapsed > m_stats.maxCheckout)
+        {
+            m_stats.maxCheckout = elapsed;
+        }
+        if (miss)
+        {
+            m_stats.created += 1;
+            m_stats.misses += 1;
+        }
+        else
+        {
+            m_stats.idle -= 1;
+            if (entry->used)
+            {
+                m_stats.reuses += 1;
+            }
+        }
+        m_stats.inUse += 1;
+        entry->used = true;
+        return entry->vm;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Resets a VM to its baseline and gives it back to the pool
+    ///
+    /// \param vm A VM returned by Acquire
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Release(SqratVM* vm)
+    {
+        Entry* entry;
+        {
+            SpinLockGuard guard(m_lock);
+            Entry** found = m_inUse.Find(vm);
+            assert(found != NULL); // fails if the VM was not acquired from this pool
+            if (found == NULL)
+            {
+                return;
+            }
+            entry = *found;
+            m_inUse.Erase(vm);
+        }
+
+        double start = Now();
+        Reset(entry);
+        double elapsed = Now() - start;
+
+        SpinLockGuard guard(m_lock);
+        m_idle.push_back(entry);
+        m_stats.resets += 1;
+        m_stats.resetTime += elapsed;
+        m_stats.inUse -= 1;
+        m_stats.idle += 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the counters of the pool
+    ///
+    /// \return A copy of the counters at the time of the call
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    VMPoolStats GetStats()
+    {
+        SpinLockGuard guard(m_lock);
+        return m_stats;
+    }
+
+private:
+
+    // A pooled VM and the baseline it is reset to
+    struct Entry
+    {
+        SqratVM*  vm;
+        HSQOBJECT baseline; // shallow copy of the root table taken after initialization
+        SQInteger top;
+        bool      used;
+    };
+
+    // Monotonic wall clock time in seconds (clock() would measure the CPU time of the process instead)
+    static double Now()
+    {
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#elif defined(_WIN32)
+        long long count, frequency; // LARGE_INTEGER is a 64-bit integer
+        QueryPerformanceCounter(reinterpret_cast<union _LARGE_INTEGER*>(&count));
+        QueryPerformanceFrequency(reinterpret_cast<union _LARGE_INTEGER*>(&frequency));
+        return double(count) / double(frequency);
+#else
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return double(now.tv_sec) + double(now.tv_nsec) * 1e-9;
+#endif
+    }
+
+    Entry* CreateEntry()
+    {
+        Entry* entry = new Entry;
+        entry->vm = new SqratVM(m_stackSize, m_libs);
+        entry->used = false;
+        if (m_init != NULL)
+        {
+            m_init(*entry->vm);
+        }
+        HSQUIRRELVM v = entry->vm->GetVM();
+        sq_pushroottable(v);
+        sq_clone(v, -1);
+        sq_resetobject(&entry->baseline);
+        sq_getstackobj(v, -1, &entry->baseline);
+        sq_addref(v, &entry->baseline);
+        sq_pop(v, 2);
+        entry->top = sq_gettop(v);
+        return entry;
+    }
+
+    void DestroyEntry(Entry* entry)
+    {
+        sq_release(entry->vm->GetVM(), &entry->baseline);
+        delete entry->vm;
+        delete entry;
+    }
+
+    static void Reset(Entry* entry)
+    {
+        HSQUIRRELVM v = entry->vm->GetVM();
+        sq_settop(v, entry->top);
+        sq_pushroottable(v);
+
+        // remove the slots added since the baseline (collected first: the table must not change while iterating it)
+        sq_newarray(v, 0);
+        sq_pushnull(v);
+        while (SQ_SUCCEEDED(sq_next(v, -3)))
+        {
+            sq_pop(v, 1); // value
+            sq_pushobject(v, entry->baseline);
+            sq_push(v, -2);
+            if (SQ_FAILED(sq_rawget(v, -2)))
+            {
+                sq_pop(v, 1); // baseline
+                sq_arrayappend(v, -3);
+            }
+            else
+            {
+                sq_pop(v, 3); // value, baseline and key
+            }
+        }
+        sq_pop(v, 1); // iterator
+        SQInteger added = sq_getsize(v, -1);
+        for (SQInteger i = 0; i < added; ++i)
+        {
+            sq_pushinteger(v, i);
+            sq_rawget(v, -2);
+            sq_rawdeleteslot(v, -3, SQFalse);
+        }
+        sq_pop(v, 1); // array
+
+        // put back the baseline values (replaces the slots scripts assigned and restores the ones they deleted)
+        sq_pushobject(v, entry->baseline);
+        sq_pushnull(v);
+        while (SQ_SUCCEEDED(sq_next(v, -2)))
+        {
+            sq_newslot(v, -5, SQFalse);
+        }
+        sq_pop(v, 3); // iterator, baseline and root table
+
+        sq_collectgarbage(v);
+        entry->vm->SetLastErrorMsg(string());
+    }
+
+    SpinLock                     m_lock;
+    std::vector<Entry*>          m_idle;
+    PointerMap<SqratVM*, Entry*> m_inUse;
+    VMPoolStats                  m_stats;
+    INITFUNC                     m_init;
+    int                          m_stackSize;
+    unsigned char                m_libs;
+
+    SqratVMPool(const SqratVMPool&);
+    SqratVMPool& operator=(const SqratVMPool&);
+};
+
+}
+
+#endif
@@ -0,0 +1,442 @@
+//
+// SqratZygote: Process Forking Pre-Initialized SqratVM
+//
+
+//
+// Copyright (c) 2009 Brandon Jones
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+//    1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+//
+//    2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+//    3. This notice may not be removed or altered from any source
+//    distribution.
+//
+
+#if !defined(_SCRAT_ZYGOTE_H_)
+#define _SCRAT_ZYGOTE_H_
+
+#if !defined(_WIN32) // needs fork() and Unix sockets
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "sqratVM.h"
+
+namespace Sqrat
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Process that keeps a fully initialized SqratVM and forks a child process for every script it is asked to run
+///
+/// \remarks
+/// Start forks the zygote process, which creates a SqratVM, calls the initialization function (to bind classes...) and
+/// runs the bootstrap files. Every later Spawn sends a script to the zygote over a Unix socket; the zygote forks a child
+/// that inherits the warmed VM copy-on-write, runs the script in it and exits with the resulting SqratVM::ERROR_STATE.
+/// Nothing the children do is seen by the zygote or by later children.
+///
+/// \remarks
+/// Start must be called while the process has a single thread (see Start).
+///
+/// \remarks
+/// The zygote only serves one request at a time: Wait blocks it until the child exits. Children that are never waited
+/// for stay zombies until the zygote stops. A SqratZygote must only be used by one thread at a time.
+///
+/// \remarks
+/// Children exit with _exit after flushing the standard streams, so atexit handlers and destructors of the process that
+/// created the SqratZygote do not run in them.
+///
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SqratZygote
+{
+public:
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Function called on the VM of the zygote before the bootstrap files are run
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    typedef void (*INITFUNC)(SqratVM& vm);
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Constructs the SqratZygote (the zygote process is created by Start)
+    ///
+    /// \param init             Function initializing the VM (or NULL)
+    /// \param initialStackSize Initial size of the execution stack of the VM
+    /// \param libsToLoad       Specifies what standard Squirrel libraries should be loaded in the VM
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SqratZygote(INITFUNC init = NULL, int initialStackSize = 1024, unsigned char libsToLoad = SqratVM::LIB_ALL)
+        : m_init(init)
+        , m_stackSize(initialStackSize)
+        , m_libs(libsToLoad)
+        , m_pid(-1)
+        , m_socket(-1)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Destructor (stops the zygote process)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ~SqratZygote()
+    {
+        Stop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Adds a file containing a Squirrel script run by the zygote after the initialization function (call before Start)
+    ///
+    /// \param file File path containing a Squirrel script
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void AddBootstrapFile(const Sqrat::string& file)
+    {
+        m_bootstrap.push_back(file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Creates the zygote process and waits until its VM is initialized
+    ///
+    /// \return SQRAT_NO_ERROR if the zygote is ready, otherwise the error of the bootstrap file that failed
+    ///         (or SQRAT_RUNTIME_ERROR if the process could not be created)
+    ///
+    /// \remarks
+    /// Call Start before the process creates any thread. The zygote allocates memory, creates the VM and calls the
+    /// initialization function right after fork(), which deadlocks if another thread held a lock (like the one of malloc)
+    /// at the time of the fork.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    SqratVM::ERROR_STATE Start()
+    {
+        if (m_pid > 0)
+        {
+            return SqratVM::SQRAT_NO_ERROR;
+        }
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+        {
+            return SqratVM::SQRAT_RUNTIME_ERROR;
+        }
+#if !defined (MSG_NOSIGNAL) && defined (SO_NOSIGPIPE)
+        int on = 1;
+        setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        setsockopt(fds[1], SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        fflush(NULL); // or buffered output would be written by both processes
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            close(fds[0]);
+            close(fds[1]);
+            return SqratVM::SQRAT_RUNTIME_ERROR;
+        }
+        if (pid == 0)
+        {
+            close(fds[0]);
+            Serve(fds[1]); // never returns
+        }
+        close(fds[1]);
+        m_pid = pid;
+        m_socket = fds[0];
+
+        int ready;
+        if (!ReadAll(m_socket, &ready, sizeof(ready)))
+        {
+            Reap();
+            return SqratVM::SQRAT_RUNTIME_ERROR;
+        }
+        if (ready != SqratVM::SQRAT_NO_ERROR)
+        {
+            Reap(); // the zygote exits by itself after reporting the failure
+        }
+        return static_cast<SqratVM::ERROR_STATE>(ready);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Stops the zygote process (children already spawned keep running)
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Stop()
+    {
+        if (m_pid <= 0)
+        {
+            return;
+        }
+        Request request = {REQ_QUIT, 0, 0};
+        WriteAll(m_socket, &request, sizeof(request));
+        Reap();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Forks a child of the zygote that runs a string containing a Squirrel script
+    ///
+    /// \param str String containing a Squirrel script
+    ///
+    /// \return Process ID of the child (give it to Wait), or -1 on failure
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int SpawnString(const Sqrat::string& str)
+    {
+        return Spawn(REQ_RUN_STRING, str);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Forks a child of the zygote that runs a file containing a Squirrel script
+    ///
+    /// \param file File path containing a Squirrel script
+    ///
+    /// \return Process ID of the child (give it to Wait), or -1 on failure
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int SpawnFile(const Sqrat::string& file)
+    {
+        return Spawn(REQ_RUN_FILE, file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Waits for a child of the zygote to exit
+    ///
+    /// \param pid Process ID returned by SpawnString or SpawnFile
+    ///
+    /// \return The ERROR_STATE of the script the child ran, or -1 if the child did not exit normally
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int Wait(int pid)
+    {
+        Request request = {REQ_WAIT, pid, 0};
+        return Call(request, NULL);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs a string containing a Squirrel script in a child of the zygote and waits for it
+    ///
+    /// \param str String containing a Squirrel script
+    ///
+    /// \return Same as Wait
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int DoString(const Sqrat::string& str)
+    {
+        int pid = SpawnString(str);
+        return pid > 0 ? Wait(pid) : -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Runs a file containing a Squirrel script in a child of the zygote and waits for it
+    ///
+    /// \param file File path containing a Squirrel script
+    ///
+    /// \return Same as Wait
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int DoFile(const Sqrat::string& file)
+    {
+        int pid = SpawnFile(file);
+        return pid > 0 ? Wait(pid) : -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Gets the process ID of the zygote
+    ///
+    /// \return Process ID of the zygote, or -1 if it is not started
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int GetPid() const
+    {
+        return m_pid;
+    }
+
+private:
+
+    // Control protocol: every request is a Request followed by size bytes of script (or path), answered by one int
+    enum RequestKind
+    {
+        REQ_RUN_STRING, // answered with the pid of the child
+        REQ_RUN_FILE,   // answered with the pid of the child
+        REQ_WAIT,       // arg is the pid of a child, answered with its ERROR_STATE (or -1)
+        REQ_QUIT        // not answered, the zygote exits
+    };
+
+    struct Request
+    {
+        int          kind;
+        int          arg;
+        unsigned int size;
+    };
+
+    // Writing to a process that exited fails with EPIPE instead of raising SIGPIPE (MSG_NOSIGNAL, or SO_NOSIGPIPE set
+    // on the sockets by Start where it is not available)
+    static bool WriteAll(int fd, const void* data, size_t size)
+    {
+#if defined (MSG_NOSIGNAL)
+        const int flags = MSG_NOSIGNAL;
+#else
+        const int flags = 0;
+#endif
+        const char* p = static_cast<const char*>(data);
+        while (size > 0)
+        {
+            ssize_t n = send(fd, p, size, flags);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n <= 0)
+            {
+                return false;
+            }
+            p += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    static bool ReadAll(int fd, void* data, size_t size)
+    {
+        char* p = static_cast<char*>(data);
+        while (size > 0)
+        {
+            ssize_t n = read(fd, p, size);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n <= 0)
+            {
+                return false;
+            }
+            p += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    // Closes the control socket and waits for the zygote to exit
+    void Reap()
+    {
+        close(m_socket);
+        while (waitpid(m_pid, NULL, 0) < 0 && errno == EINTR)
+        {
+        }
+        m_pid = -1;
+        m_socket = -1;
+    }
+
+    int Spawn(int kind, const Sqrat::string& script)
+    {
+        Request request = {kind, 0, static_cast<unsigned int>(script.size() * sizeof(SQChar))};
+        return Call(request, script.data());
+    }
+
+    int Call(const Request& request, const SQChar* payload)
+    {
+        int answer;
+        if (m_pid <= 0 ||
+            !WriteAll(m_socket, &request, sizeof(request)) ||
+            !WriteAll(m_socket, payload, request.size) ||
+            !ReadAll(m_socket, &answer, sizeof(answer)))
+        {
+            return -1;
+        }
+        return answer;
+    }
+
+    // Main loop of the zygote process
+    void Serve(int fd)
+    {
+        SqratVM vm(m_stackSize, m_libs);
+        if (m_init != NULL)
+        {
+            m_init(vm);
+        }
+        int ready = SqratVM::SQRAT_NO_ERROR;
+        for (size_t i = 0; i < m_bootstrap.size() && ready == SqratVM::SQRAT_NO_ERROR; ++i)
+        {
+            ready = vm.DoFile(m_bootstrap[i]);
+        }
+        WriteAll(fd, &ready, sizeof(ready));
+        if (ready != SqratVM::SQRAT_NO_ERROR)
+        {
+            Exit(1);
+        }
+
+        Request request;
+        while (ReadAll(fd, &request, sizeof(request)) && request.kind != REQ_QUIT)
+        {
+            Sqrat::string script(request.size / sizeof(SQChar), 0);
+            if (request.size > 0 && !ReadAll(fd, &script[0], request.size))
+            {
+                break;
+            }
+            int answer = -1;
+            if (request.kind == REQ_WAIT)
+            {
+                int status;
+                pid_t pid;
+                while ((pid = waitpid(request.arg, &status, 0)) < 0 && errno == EINTR)
+                {
+                }
+                if (pid > 0 && WIFEXITED(status))
+                {
+                    answer = WEXITSTATUS(status);
+                }
+            }
+            else
+            {
+                fflush(NULL);
+                pid_t pid = fork();
+                if (pid == 0)
+                {
+                    close(fd);
+                    Exit(request.kind == REQ_RUN_FILE ? vm.DoFile(script) : vm.DoString(script));
+                }
+                answer = pid;
+            }
+            if (!WriteAll(fd, &answer, sizeof(answer)))
+            {
+                break;
+            }
+        }
+        Exit(0);
+    }
+
+    static void Exit(int status)
+    {
+        fflush(NULL);
+        _exit(status);
+    }
+
+    std::vector<Sqrat::string> m_bootstrap;
+    INITFUNC                   m_init;
+    int                        m_stackSize;
+    unsigned char              m_libs;
+    pid_t                      m_pid;
+    int                        m_socket;
+
+    SqratZygote(const SqratZygote&);
+    SqratZygote& operator=(const SqratZygote&);
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+//
+// AccessorBench: cost of reading and writing bound variables and properties from scripts
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class Body {
+public:
+    Body() : mass(1), speed(0) {}
+    float GetMass() const { return mass; }
+    void SetMass(float m) { mass = m; }
+    float mass;
+    float speed;
+};
+
+static const long ITERATIONS = 1000000;
+
+static void BenchScript(HSQUIRRELVM vm, const char* name, const SQChar* code) {
+    double seconds = SqratBench::RunScript(vm, code);
+    if (seconds >= 0) {
+        SqratBench::Report(name, ITERATIONS, seconds);
+    }
+}
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    Class<Body> cls(vm, _SC("Body"));
+    cls.Var(_SC("mass"), &Body::mass);
+    cls.Var<float, &Body::speed>(_SC("speed"));
+    cls.Prop(_SC("massProp"), &Body::GetMass, &Body::SetMass);
+    RootTable(vm).Bind(_SC("Body"), cls);
+
+    BenchScript(vm, "Var read", _SC(" \
+        local b = Body(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = b.mass; \
+        "));
+    BenchScript(vm, "Var write", _SC(" \
+        local b = Body(); \
+        for (local i = 0; i < 1000000; ++i) b.mass = 2.0; \
+        "));
+    BenchScript(vm, "Var<V, member> read", _SC(" \
+        local b = Body(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = b.speed; \
+        "));
+    BenchScript(vm, "Var<V, member> write", _SC(" \
+        local b = Body(); \
+        for (local i = 0; i < 1000000; ++i) b.speed = 2.0; \
+        "));
+    BenchScript(vm, "Prop read", _SC(" \
+        local b = Body(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = b.massProp; \
+        "));
+    BenchScript(vm, "Prop write", _SC(" \
+        local b = Body(); \
+        for (local i = 0; i < 1000000; ++i) b.massProp = 2.0; \
+        "));
+    BenchScript(vm, "empty loop (baseline)", _SC(" \
+        local b = Body(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = i; \
+        "));
+
+    sq_close(vm);
+    return 0;
+}
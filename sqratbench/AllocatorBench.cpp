@@ -0,0 +1,103 @@
+//
+// AllocatorBench: cost of creating and releasing small value instances from scripts with each allocator
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class HeapVec3 {
+public:
+    HeapVec3() : x(0), y(0), z(0) {}
+    HeapVec3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+    float x, y, z;
+};
+
+class InlineVec3 {
+public:
+    InlineVec3() : x(0), y(0), z(0) {}
+    InlineVec3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+    float x, y, z;
+};
+
+class PooledVec3 {
+public:
+    PooledVec3() : x(0), y(0), z(0) {}
+    PooledVec3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+    float x, y, z;
+};
+
+static const long ITERATIONS = 1000000;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    Class<HeapVec3> heap(vm, _SC("HeapVec3"));
+    heap.Ctor<float, float, float>();
+    heap.Var(_SC("x"), &HeapVec3::x);
+    RootTable(vm).Bind(_SC("HeapVec3"), heap);
+
+    Class<InlineVec3, InlineAllocator<InlineVec3> > inl(vm, _SC("InlineVec3"));
+    inl.Ctor<float, float, float>();
+    inl.Var(_SC("x"), &InlineVec3::x);
+    RootTable(vm).Bind(_SC("InlineVec3"), inl);
+
+    Class<PooledVec3, PoolAllocator<PooledVec3> > pooled(vm, _SC("PooledVec3"));
+    pooled.Ctor<float, float, float>();
+    pooled.Var(_SC("x"), &PooledVec3::x);
+    RootTable(vm).Bind(_SC("PooledVec3"), pooled);
+
+    double seconds = SqratBench::RunScript(vm, _SC(" \
+        for (local i = 0; i < 1000000; ++i) HeapVec3(1.0, 2.0, 3.0); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("DefaultAllocator script construction", ITERATIONS, seconds);
+    }
+
+    seconds = SqratBench::RunScript(vm, _SC(" \
+        for (local i = 0; i < 1000000; ++i) InlineVec3(1.0, 2.0, 3.0); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("InlineAllocator script construction", ITERATIONS, seconds);
+    }
+
+    seconds = SqratBench::RunScript(vm, _SC(" \
+        for (local i = 0; i < 1000000; ++i) PooledVec3(1.0, 2.0, 3.0); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("PoolAllocator script construction", ITERATIONS, seconds);
+    }
+
+    {
+        HeapVec3 v;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            PushVar(vm, v);
+            sq_pop(vm, 1);
+        }
+        SqratBench::Report("DefaultAllocator PushVar copy", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        InlineVec3 v;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            PushVar(vm, v);
+            sq_pop(vm, 1);
+        }
+        SqratBench::Report("InlineAllocator PushVar copy", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        PooledVec3 v;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            PushVar(vm, v);
+            sq_pop(vm, 1);
+        }
+        SqratBench::Report("PoolAllocator PushVar copy", ITERATIONS, timer.Seconds());
+    }
+
+    sq_close(vm);
+    return 0;
+}
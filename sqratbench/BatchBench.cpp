@@ -0,0 +1,73 @@
+//
+// BatchBench: cost of calling a script function for every element of a C++ container,
+// with a loop over Function::Execute/TryEvaluate compared to Function::ExecuteBatch/EvaluateBatch
+//
+
+#include <vector>
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static const long ENTITIES = 50000;
+static const long ROUNDS = 20;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    SqratBench::RunScript(vm, _SC(" \
+        ticks <- 0; \
+        function onTick(id) { ::ticks++; } \
+        function score(id) { return id * 2; } \
+        "));
+    Function onTick = RootTable(vm).GetFunction(_SC("onTick"));
+    Function score = RootTable(vm).GetFunction(_SC("score"));
+
+    std::vector<int> entities(ENTITIES);
+    for (long i = 0; i < ENTITIES; ++i) {
+        entities[i] = static_cast<int>(i);
+    }
+    std::vector<int> scores(ENTITIES);
+    std::vector<BatchError> errors;
+
+    {
+        SqratBench::Timer timer;
+        for (long r = 0; r < ROUNDS; ++r) {
+            for (std::vector<int>::iterator it = entities.begin(); it != entities.end(); ++it) {
+                onTick.Execute(*it);
+            }
+        }
+        SqratBench::Report("loop of Execute", ENTITIES * ROUNDS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long r = 0; r < ROUNDS; ++r) {
+            onTick.ExecuteBatch(entities.begin(), entities.end(), &errors);
+        }
+        SqratBench::Report("ExecuteBatch", ENTITIES * ROUNDS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long r = 0; r < ROUNDS; ++r) {
+            for (long i = 0; i < ENTITIES; ++i) {
+                score.TryEvaluate(scores[i], entities[i]);
+            }
+        }
+        SqratBench::Report("loop of TryEvaluate<int>", ENTITIES * ROUNDS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long r = 0; r < ROUNDS; ++r) {
+            score.EvaluateBatch<int>(entities.begin(), entities.end(), scores.begin(), &errors);
+        }
+        SqratBench::Report("EvaluateBatch<int>", ENTITIES * ROUNDS, timer.Seconds());
+    }
+
+    onTick.Release();
+    score.Release();
+    sq_close(vm);
+    return 0;
+}
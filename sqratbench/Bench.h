@@ -0,0 +1,79 @@
+//
+// Bench.h: Helpers shared by the Sqrat micro benchmarks
+//
+
+#if !defined(SQRAT_BENCH_H)
+#define SQRAT_BENCH_H
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <squirrel.h>
+#include <sqstdio.h>
+#include <sqrat.h>
+
+// build_bench.sh builds every benchmark a second time with SQRAT_BENCH_VARIANT_BUILD and the variant flags defined
+#if defined(SQRAT_BENCH_VARIANT_BUILD)
+#define SQRAT_BENCH_VARIANT "variant"
+#else
+#define SQRAT_BENCH_VARIANT "default"
+#endif
+
+namespace SqratBench {
+
+// Measures processor time between its construction and a call to Seconds
+class Timer {
+public:
+    Timer() : start(clock()) {}
+
+    double Seconds() const {
+        return double(clock() - start) / CLOCKS_PER_SEC;
+    }
+
+private:
+    clock_t start;
+};
+
+// Prints the time taken per iteration of a benchmark in a format that is easy to diff between variants
+inline void Report(const char* name, long iterations, double seconds) {
+    printf("%-12s %-40s %12.1f ns/op\n", SQRAT_BENCH_VARIANT, name, seconds * 1e9 / iterations);
+}
+
+static void printfunc(HSQUIRRELVM v, const SQChar* s, ...) {
+    va_list vl;
+    va_start(vl, s);
+    vprintf(s, vl);
+    va_end(vl);
+}
+
+// Opens a VM with a print function so compile and runtime errors are visible
+inline HSQUIRRELVM OpenVM() {
+    HSQUIRRELVM vm = sq_open(1024);
+#if SQUIRREL_VERSION_NUMBER >= 300
+    sq_setprintfunc(vm, printfunc, printfunc);
+#else
+    sq_setprintfunc(vm, printfunc);
+#endif
+    return vm;
+}
+
+// Compiles and runs a script, returning processor time taken by the run (or a negative value on failure)
+inline double RunScript(HSQUIRRELVM vm, const SQChar* code) {
+    Sqrat::Script script(vm);
+    Sqrat::string err;
+    if (!script.CompileString(code, err)) {
+        printf("compile failed: %s\n", err.c_str());
+        return -1.0;
+    }
+    Timer timer;
+    if (!script.Run(err)) {
+        printf("run failed: %s\n", err.c_str());
+        return -1.0;
+    }
+    return timer.Seconds();
+}
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+//
+// BindingBench: cost of binding a set of classes in a new VM, run directly or replayed from a BindingSet
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+template <int N>
+class Entity {
+public:
+    Entity() : x(0), y(0), health(100) {}
+    float GetX() const { return x; }
+    void SetX(float v) { x = v; }
+    void Move(float dx, float dy) { x += dx; y += dy; }
+    int Damage(int n) { return health -= n; }
+    bool Alive() const { return health > 0; }
+    float x, y;
+    int health;
+};
+
+// Binds Entity<0> to Entity<N - 1>, each with a handful of members like a typical game API
+template <int N>
+struct BindEntities {
+    static void Bind(HSQUIRRELVM vm) {
+        BindEntities<N - 1>::Bind(vm);
+        SQChar name[32];
+        scsprintf(name, _SC("Entity%d"), N - 1);
+        Class<Entity<N - 1> > cls(vm, name);
+        cls.Func(_SC("Move"), &Entity<N - 1>::Move)
+           .Func(_SC("Damage"), &Entity<N - 1>::Damage)
+           .Func(_SC("Alive"), &Entity<N - 1>::Alive)
+           .Prop(_SC("px"), &Entity<N - 1>::GetX, &Entity<N - 1>::SetX)
+           .Var(_SC("x"), &Entity<N - 1>::x)
+           .Var(_SC("y"), &Entity<N - 1>::y)
+           .Var(_SC("health"), &Entity<N - 1>::health);
+        RootTable(vm).Bind(name, cls);
+    }
+};
+
+template <>
+struct BindEntities<0> {
+    static void Bind(HSQUIRRELVM) {}
+};
+
+static const int CLASSES = 64;
+static const long VMS = 200;
+
+static void BindAll(HSQUIRRELVM vm) {
+    BindEntities<CLASSES>::Bind(vm);
+}
+
+int main() {
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < VMS; ++i) {
+            HSQUIRRELVM vm = sq_open(1024);
+            sq_close(vm);
+        }
+        SqratBench::Report("sq_open + sq_close (baseline)", VMS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < VMS; ++i) {
+            HSQUIRRELVM vm = sq_open(1024);
+            BindAll(vm);
+            sq_close(vm);
+        }
+        SqratBench::Report("bind 64 classes directly", VMS, timer.Seconds());
+    }
+
+    BindingSet api;
+    {
+        SqratBench::Timer timer;
+        api.Record(&BindAll);
+        SqratBench::Report("record 64 classes (once)", 1, timer.Seconds());
+    }
+
+    if (api.IsComplete()) { // nothing is recorded without VM data
+        SqratBench::Timer timer;
+        for (long i = 0; i < VMS; ++i) {
+            HSQUIRRELVM vm = sq_open(1024);
+            api.Apply(vm);
+            sq_close(vm);
+        }
+        SqratBench::Report("BindingSet::Apply 64 classes", VMS, timer.Seconds());
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+//
+// BindingSizeBench: a translation unit that binds many distinct signatures, compiled by compile_bench.sh to compare the
+// compile time and object size of the expanded binding engine and the variadic one (SCRAT_USE_CXX11_OPTIMIZATIONS)
+//
+
+#include <squirrel.h>
+#include <sqrat.h>
+
+using namespace Sqrat;
+
+// Every Entity<N> is a distinct bound class, so each of its methods needs its own set of binding functions
+template <int N>
+class Entity {
+public:
+    Entity() : x(0), y(0), z(0) {}
+    Entity(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+
+    float Length() const { return x + y + z; }
+    void Move(float dx, float dy, float dz) { x += dx; y += dy; z += dz; }
+    bool Near(const Entity& o, float range) const { return Length() - o.Length() < range; }
+    int Pack(int a, int b, int c, int d, int e, int f) { return a + b + c + d + e + f; }
+    const SQChar* Name() const { return _SC("entity"); }
+    Entity& Self() { return *this; }
+    void Scale(float s) { x *= s; y *= s; z *= s; }
+    void Scale(float sx, float sy, float sz) { x *= sx; y *= sy; z *= sz; }
+
+    static int Count(int a, int b) { return a + b; }
+
+    float x, y, z;
+};
+
+template <int N>
+static float EntityDistance(Entity<N>* a, Entity<N>* b) {
+    return a->Length() - b->Length();
+}
+
+template <int N>
+static void BindEntity(HSQUIRRELVM vm) {
+    typedef Entity<N> E;
+    Class<E> cls(vm, _SC("Entity"));
+    cls.template Ctor<float, float, float>()
+        .Func(_SC("Length"), &E::Length)
+        .Func(_SC("Move"), &E::Move)
+        .Func(_SC("Near"), &E::Near)
+        .Func(_SC("Pack"), &E::Pack)
+        .Func(_SC("Name"), &E::Name)
+        .Func(_SC("Self"), &E::Self)
+        .template Overload<void (E::*)(float)>(_SC("Scale"), &E::Scale)
+        .template Overload<void (E::*)(float, float, float)>(_SC("Scale"), &E::Scale)
+        .StaticFunc(_SC("Count"), &E::Count)
+        .GlobalFunc(_SC("Distance"), &EntityDistance<N>)
+        .Var(_SC("x"), &E::x)
+        .Var(_SC("y"), &E::y)
+        .Var(_SC("z"), &E::z);
+    RootTable(vm).Bind(_SC("Entity"), cls);
+}
+
+// Instantiates BindEntity<0> .. BindEntity<N - 1>
+template <int N>
+struct BindEntities {
+    static void Bind(HSQUIRRELVM vm) {
+        BindEntities<N - 1>::Bind(vm);
+        BindEntity<N - 1>(vm);
+    }
+};
+
+template <>
+struct BindEntities<0> {
+    static void Bind(HSQUIRRELVM) {}
+};
+
+#if !defined(SQRAT_BENCH_ENTITIES)
+#define SQRAT_BENCH_ENTITIES 32
+#endif
+
+void BindAll(HSQUIRRELVM vm) {
+    BindEntities<SQRAT_BENCH_ENTITIES>::Bind(vm);
+}
@@ -0,0 +1,79 @@
+//
+// BytecodeCacheBench: cost of Script::CompileFile on a set of script files, compiled from source or loaded from the cache
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static const int FILES = 200;
+
+static void FileName(char* name, int i) {
+    sprintf(name, "bench_cache_%d.nut", i);
+}
+
+// Writes script files with a few functions and a class each, like the modules of a typical service
+static bool WriteFiles() {
+    for (int i = 0; i < FILES; ++i) {
+        char name[64];
+        FileName(name, i);
+        FILE* file = fopen(name, "w");
+        if (file == NULL) {
+            return false;
+        }
+        for (int f = 0; f < 20; ++f) {
+            fprintf(file, "function module%d_func%d(a, b) { local t = {}; for (local i = 0; i < a; ++i) t[i] <- i * b; return t.len(); }\n", i, f);
+        }
+        fprintf(file, "class Module%d { value = 0; constructor(v) { value = v; } function Get() { return value; } }\n", i);
+        fclose(file);
+    }
+    return true;
+}
+
+static void CompileAll(HSQUIRRELVM vm) {
+    Script script(vm);
+    string err;
+    for (int i = 0; i < FILES; ++i) {
+        char name[64];
+        FileName(name, i);
+        SQChar path[64];
+        for (int c = 0; (path[c] = name[c]) != 0; ++c) {}
+        script.CompileFile(path, err);
+    }
+}
+
+int main() {
+    if (!WriteFiles()) {
+        return 1;
+    }
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    {
+        SqratBench::Timer timer;
+        CompileAll(vm);
+        SqratBench::Report("CompileFile from source", FILES, timer.Seconds());
+    }
+
+    BytecodeCache::Enable();
+    {
+        SqratBench::Timer timer;
+        CompileAll(vm);
+        SqratBench::Report("CompileFile filling the cache", FILES, timer.Seconds());
+    }
+    {
+        SqratBench::Timer timer;
+        CompileAll(vm);
+        SqratBench::Report("CompileFile from the cache", FILES, timer.Seconds());
+    }
+    BytecodeCache::Disable();
+
+    sq_close(vm);
+    for (int i = 0; i < FILES; ++i) {
+        char name[64];
+        FileName(name, i);
+        remove(name);
+        strcat(name, ".cache");
+        remove(name);
+    }
+    return 0;
+}
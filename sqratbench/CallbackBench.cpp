@@ -0,0 +1,62 @@
+//
+// CallbackBench: cost of calling script functions from C++ with each way Function offers
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static const long ITERATIONS = 1000000;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    SqratBench::RunScript(vm, _SC(" \
+        function add(a, b) { return a + b; } \
+        "));
+    Function add = RootTable(vm).GetFunction(_SC("add"));
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            add.Execute(1, 2);
+        }
+        SqratBench::Report("Execute", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        int sum = 0;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            sum += *add.Evaluate<int>(1, 2);
+        }
+        SqratBench::Report("Evaluate<int> (SharedPtr)", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        int sum = 0;
+        int ret;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            add.TryEvaluate(ret, 1, 2);
+            sum += ret;
+        }
+        SqratBench::Report("TryEvaluate<int>", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        PreparedFunction prepared(add);
+        int sum = 0;
+        int ret;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            prepared.TryEvaluate(ret, 1, 2);
+            sum += ret;
+        }
+        SqratBench::Report("PreparedFunction::TryEvaluate<int>", ITERATIONS, timer.Seconds());
+    }
+
+    add.Release();
+    sq_close(vm);
+    return 0;
+}
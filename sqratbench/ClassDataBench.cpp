@@ -0,0 +1,88 @@
+//
+// ClassDataBench: cost of looking up the per-VM class data of a bound class
+//
+// Build once as is and once with SCRAT_NO_VM_DATA defined (build_bench.sh does both) to compare the
+// cached lookup against the registry table lookup it replaces.
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class Particle {
+public:
+    Particle() : x(0) {}
+    void Move(int dx) { x += dx; }
+    int GetX() const { return x; }
+    int x;
+};
+
+static const long ITERATIONS = 1000000;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    Class<Particle> cls(vm, _SC("Particle"));
+    cls.Func(_SC("Move"), &Particle::Move);
+    cls.Func(_SC("GetX"), &Particle::GetX);
+    cls.Var(_SC("x"), &Particle::x);
+    RootTable(vm).Bind(_SC("Particle"), cls);
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            ClassType<Particle>::getClassData(vm);
+        }
+        SqratBench::Report("ClassType::getClassData", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            ClassType<Particle>::hasClassData(vm);
+        }
+        SqratBench::Report("ClassType::hasClassData", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        Particle particle;
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            PushVar(vm, &particle);
+            Var<Particle*>(vm, -1);
+            sq_pop(vm, 1);
+        }
+        SqratBench::Report("PushVar + Var<Particle*>", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        Particle particle;
+        PushVar(vm, &particle);
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            Var<Particle*>(vm, -1);
+        }
+        SqratBench::Report("Var<Particle*> (ClassType::GetInstance)", ITERATIONS, timer.Seconds());
+        sq_pop(vm, 1);
+    }
+
+    double seconds = SqratBench::RunScript(vm, _SC(" \
+        local p = Particle(); \
+        for (local i = 0; i < 1000000; ++i) p.Move(1); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("script member call", ITERATIONS, seconds);
+    }
+
+    seconds = SqratBench::RunScript(vm, _SC(" \
+        local p = Particle(); \
+        local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = p.x; \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("script member variable read", ITERATIONS, seconds);
+    }
+
+    sq_close(vm);
+    return 0;
+}
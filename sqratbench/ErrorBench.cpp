@@ -0,0 +1,69 @@
+//
+// ErrorBench: cost of checking for, raising and clearing a Sqrat error
+//
+// Every bound call checks for a pending error (SQCATCH_NOEXCEPT calls Error::Occurred) after reading its arguments.
+// Build once as is and once with SCRAT_NO_VM_DATA defined (build_bench.sh does both) to compare the error kept in the
+// data of the VM against the "__error" slot of the registry table. Build with VARIANT_CFLAGS=-DSCRAT_VM_DATA_IN_FOREIGN_PTR
+// to measure the foreign pointer cache instead.
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static const long ITERATIONS = 1000000;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    {
+        SqratBench::Timer timer;
+        long occurred = 0;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            occurred += Error::Occurred(vm) ? 1 : 0;
+        }
+        SqratBench::Report("Error::Occurred (no error)", ITERATIONS, timer.Seconds());
+        if (occurred != 0) {
+            printf("unexpected error\n");
+        }
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            Error::Clear(vm);
+        }
+        SqratBench::Report("Error::Clear", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            Error::Throw(vm, _SC("bench"));
+            Error::Message(vm);
+        }
+        SqratBench::Report("Error::Throw + Error::Message", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        // what every check cost when the error was looked up by a string key in the registry table
+        SqratBench::Timer timer;
+        long occurred = 0;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            sq_pushregistrytable(vm);
+            sq_pushstring(vm, _SC("__error"), -1);
+            if (SQ_SUCCEEDED(sq_rawget(vm, -2))) {
+                ++occurred;
+                sq_pop(vm, 1);
+            }
+            sq_pop(vm, 1);
+        }
+        SqratBench::Report("registry \"__error\" lookup", ITERATIONS, timer.Seconds());
+        if (occurred != 0) {
+            printf("unexpected error\n");
+        }
+    }
+
+    sq_close(vm);
+    return 0;
+}
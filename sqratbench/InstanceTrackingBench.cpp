@@ -0,0 +1,119 @@
+//
+// InstanceTrackingBench: cost of the map Sqrat uses to find the instance that owns a C++ object
+//
+// Compares the map instances used to be tracked with (std::map, or std::unordered_map with SCRAT_USE_CXX11_OPTIMIZATIONS),
+// the open addressing PointerMap now used and classes bound with Class::TrackInstances(false).
+//
+
+#include <vector>
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class Tracked {
+public:
+    int x;
+};
+
+class Untracked {
+public:
+    int x;
+};
+
+static const long ITERATIONS = 1000000;
+static const size_t LIVE = 10000; // instances kept alive so the map has a realistic size
+
+template <class Map>
+static void BenchMap(const char* name, std::vector<Tracked>& objects) {
+    Map map;
+    HSQOBJECT obj;
+    sq_resetobject(&obj);
+    for (size_t i = 0; i < LIVE; ++i) {
+        map[&objects[i]] = obj;
+    }
+    SqratBench::Timer timer;
+    for (long i = 0; i < ITERATIONS; ++i) {
+        Tracked* key = &objects[LIVE + i % LIVE];
+        map[key] = obj;
+        map.find(&objects[i % LIVE]);
+        map.erase(key);
+    }
+    SqratBench::Report(name, ITERATIONS, timer.Seconds());
+}
+
+static void BenchPointerMap(const char* name, std::vector<Tracked>& objects) {
+    PointerMap<Tracked*, HSQOBJECT> map;
+    HSQOBJECT obj;
+    sq_resetobject(&obj);
+    for (size_t i = 0; i < LIVE; ++i) {
+        map[&objects[i]] = obj;
+    }
+    SqratBench::Timer timer;
+    for (long i = 0; i < ITERATIONS; ++i) {
+        Tracked* key = &objects[LIVE + i % LIVE];
+        map[key] = obj;
+        map.Find(&objects[i % LIVE]);
+        map.Erase(key);
+    }
+    SqratBench::Report(name, ITERATIONS, timer.Seconds());
+}
+
+template <class C>
+static void BenchPush(HSQUIRRELVM vm, const char* name, std::vector<C>& objects) {
+    // keep LIVE instances on the stack, then push and release a new one per iteration
+    for (size_t i = 0; i < LIVE; ++i) {
+        PushVar(vm, &objects[i]);
+    }
+    SqratBench::Timer timer;
+    for (long i = 0; i < ITERATIONS; ++i) {
+        PushVar(vm, &objects[LIVE + i % LIVE]);
+        sq_pop(vm, 1);
+    }
+    SqratBench::Report(name, ITERATIONS, timer.Seconds());
+    sq_pop(vm, static_cast<SQInteger>(LIVE));
+}
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+    sq_reservestack(vm, static_cast<SQInteger>(LIVE) + 16);
+
+    Class<Tracked> tracked(vm, _SC("Tracked"));
+    tracked.Var(_SC("x"), &Tracked::x);
+    RootTable(vm).Bind(_SC("Tracked"), tracked);
+
+    Class<Untracked> untracked(vm, _SC("Untracked"));
+    untracked.TrackInstances(false);
+    untracked.Var(_SC("x"), &Untracked::x);
+    RootTable(vm).Bind(_SC("Untracked"), untracked);
+
+    std::vector<Tracked> trackedObjects(LIVE * 2);
+    std::vector<Untracked> untrackedObjects(LIVE * 2);
+
+    BenchMap<unordered_map<Tracked*, HSQOBJECT>::type>("unordered_map insert/find/erase", trackedObjects);
+    BenchPointerMap("PointerMap insert/find/erase", trackedObjects);
+
+    BenchPush(vm, "tracked PushVar(C*) create/destroy", trackedObjects);
+    BenchPush(vm, "untracked PushVar(C*) create/destroy", untrackedObjects);
+
+    double seconds = SqratBench::RunScript(vm, _SC(" \
+        local keep = []; \
+        for (local i = 0; i < 10000; ++i) keep.append(Tracked()); \
+        for (local i = 0; i < 1000000; ++i) Tracked(); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("tracked script construction", ITERATIONS, seconds);
+    }
+
+    seconds = SqratBench::RunScript(vm, _SC(" \
+        local keep = []; \
+        for (local i = 0; i < 10000; ++i) keep.append(Untracked()); \
+        for (local i = 0; i < 1000000; ++i) Untracked(); \
+        "));
+    if (seconds >= 0) {
+        SqratBench::Report("untracked script construction", ITERATIONS, seconds);
+    }
+
+    sq_close(vm);
+    return 0;
+}
@@ -0,0 +1,56 @@
+//
+// KeyBench: cost of looking up slots from C++ by string compared to an interned Sqrat::Key
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static const long ITERATIONS = 1000000;
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    SqratBench::RunScript(vm, _SC(" \
+        entity <- { health = 100, function update(dt) { return dt; } }; \
+        "));
+    Table entity = RootTable(vm).GetSlot(_SC("entity"));
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            entity.GetSlot(_SC("health"));
+        }
+        SqratBench::Report("GetSlot(const SQChar*)", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        Key health(_SC("health"), vm);
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            entity.GetSlot(health);
+        }
+        SqratBench::Report("GetSlot(Key)", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            entity.GetFunction(_SC("update"));
+        }
+        SqratBench::Report("GetFunction(const SQChar*)", ITERATIONS, timer.Seconds());
+    }
+
+    {
+        Key update(_SC("update"), vm);
+        SqratBench::Timer timer;
+        for (long i = 0; i < ITERATIONS; ++i) {
+            entity.GetFunction(update);
+        }
+        SqratBench::Report("GetFunction(Key)", ITERATIONS, timer.Seconds());
+    }
+
+    entity.Release();
+    sq_close(vm);
+    return 0;
+}
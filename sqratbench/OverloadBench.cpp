@@ -0,0 +1,85 @@
+//
+// OverloadBench: cost of calling overloaded functions and constructors from scripts
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class Point {
+public:
+    Point() : x(0), y(0) {}
+    Point(int x_, int y_) : x(x_), y(y_) {}
+    int Move(int dx) { return x += dx; }
+    int Move(int dx, int dy) { y += dy; return x += dx; }
+    int MoveOnce(int dx) { return x += dx; }
+    int Scale(int f) { return x *= f; }
+    int Scale(float f) { return x = static_cast<int>(x * f); }
+    int Scale(const Point& p) { return x *= p.x; }
+    int x, y;
+};
+
+static int Sum(int a) { return a; }
+static int Sum(int a, int b) { return a + b; }
+static int SumOnce(int a) { return a; }
+
+static const long ITERATIONS = 1000000;
+
+static void BenchScript(HSQUIRRELVM vm, const char* name, const SQChar* code) {
+    double seconds = SqratBench::RunScript(vm, code);
+    if (seconds >= 0) {
+        SqratBench::Report(name, ITERATIONS, seconds);
+    }
+}
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    Class<Point> cls(vm, _SC("Point"));
+    cls.Ctor();
+    cls.Ctor<int, int>();
+    cls.Overload<int (Point::*)(int)>(_SC("Move"), &Point::Move);
+    cls.Overload<int (Point::*)(int, int)>(_SC("Move"), &Point::Move);
+    cls.Func(_SC("MoveOnce"), &Point::MoveOnce);
+    cls.Overload<int (Point::*)(int)>(_SC("Scale"), &Point::Scale);
+    cls.Overload<int (Point::*)(float)>(_SC("Scale"), &Point::Scale);
+    cls.Overload<int (Point::*)(const Point&)>(_SC("Scale"), &Point::Scale);
+    RootTable(vm).Bind(_SC("Point"), cls);
+
+    RootTable(vm).Overload<int (*)(int)>(_SC("Sum"), &Sum);
+    RootTable(vm).Overload<int (*)(int, int)>(_SC("Sum"), &Sum);
+    RootTable(vm).Func(_SC("SumOnce"), &SumOnce);
+
+    BenchScript(vm, "overloaded member call", _SC(" \
+        local p = Point(); \
+        for (local i = 0; i < 1000000; ++i) p.Move(1); \
+        "));
+    BenchScript(vm, "member call (not overloaded)", _SC(" \
+        local p = Point(); \
+        for (local i = 0; i < 1000000; ++i) p.MoveOnce(1); \
+        "));
+    BenchScript(vm, "overloaded by type, int argument", _SC(" \
+        local p = Point(); \
+        for (local i = 0; i < 1000000; ++i) p.Scale(1); \
+        "));
+    BenchScript(vm, "overloaded by type, instance argument", _SC(" \
+        local p = Point(); local q = Point(1, 1); \
+        for (local i = 0; i < 1000000; ++i) p.Scale(q); \
+        "));
+    BenchScript(vm, "overloaded by type, alternating arguments", _SC(" \
+        local p = Point(); local q = Point(1, 1); \
+        for (local i = 0; i < 500000; ++i) { p.Scale(1); p.Scale(1.0); } \
+        "));
+    BenchScript(vm, "overloaded global call", _SC(" \
+        for (local i = 0; i < 1000000; ++i) Sum(i, 1); \
+        "));
+    BenchScript(vm, "global call (not overloaded)", _SC(" \
+        for (local i = 0; i < 1000000; ++i) SumOnce(i); \
+        "));
+    BenchScript(vm, "overloaded constructor", _SC(" \
+        for (local i = 0; i < 1000000; ++i) Point(i, 1); \
+        "));
+
+    sq_close(vm);
+    return 0;
+}
@@ -0,0 +1,55 @@
+//
+// StringBench: cost of passing string arguments to native functions as string, const SQChar* and StringView
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+static SQInteger total = 0;
+
+static void LogString(const string& msg) {
+    total += static_cast<SQInteger>(msg.size());
+}
+
+static void LogChars(const SQChar* msg) {
+    total += msg[0];
+}
+
+static void LogView(StringView msg) {
+    total += msg.Size();
+}
+
+static const long ITERATIONS = 1000000;
+
+static void BenchScript(HSQUIRRELVM vm, const char* name, const SQChar* code) {
+    double seconds = SqratBench::RunScript(vm, code);
+    if (seconds >= 0) {
+        SqratBench::Report(name, ITERATIONS, seconds);
+    }
+}
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    RootTable(vm).Func(_SC("LogString"), &LogString);
+    RootTable(vm).Func(_SC("LogChars"), &LogChars);
+    RootTable(vm).Func(_SC("LogView"), &LogView);
+
+    // long enough to defeat the small string optimization of std::string
+    BenchScript(vm, "const string& argument", _SC(" \
+        local msg = \"player entered the northern gate of the city\"; \
+        for (local i = 0; i < 1000000; ++i) LogString(msg); \
+        "));
+    BenchScript(vm, "const SQChar* argument", _SC(" \
+        local msg = \"player entered the northern gate of the city\"; \
+        for (local i = 0; i < 1000000; ++i) LogChars(msg); \
+        "));
+    BenchScript(vm, "StringView argument", _SC(" \
+        local msg = \"player entered the northern gate of the city\"; \
+        for (local i = 0; i < 1000000; ++i) LogView(msg); \
+        "));
+
+    sq_close(vm);
+    return total == 0; // keep the work from being optimized away
+}
@@ -0,0 +1,69 @@
+//
+// UncheckedBench: cost of calling native functions bound with Func and with FuncUnchecked from scripts
+//
+
+#include "Bench.h"
+
+using namespace Sqrat;
+
+class Particle {
+public:
+    Particle() : x(0), y(0), z(0) {}
+    void Move(float dx, float dy, float dz) { x += dx; y += dy; z += dz; }
+    float X() const { return x; }
+    float x, y, z;
+};
+
+static int Add(int a, int b) {
+    return a + b;
+}
+
+static const long ITERATIONS = 1000000;
+
+static void BenchScript(HSQUIRRELVM vm, const char* name, const SQChar* code) {
+    double seconds = SqratBench::RunScript(vm, code);
+    if (seconds >= 0) {
+        SqratBench::Report(name, ITERATIONS, seconds);
+    }
+}
+
+int main() {
+    HSQUIRRELVM vm = SqratBench::OpenVM();
+
+    Class<Particle> cls(vm, _SC("Particle"));
+    cls.Func(_SC("Move"), &Particle::Move);
+    cls.FuncUnchecked(_SC("MoveUnchecked"), &Particle::Move);
+    cls.Func(_SC("X"), &Particle::X);
+    cls.FuncUnchecked(_SC("XUnchecked"), &Particle::X);
+    RootTable(vm).Bind(_SC("Particle"), cls);
+    RootTable(vm).Func(_SC("Add"), &Add);
+    RootTable(vm).FuncUnchecked(_SC("AddUnchecked"), &Add);
+
+    BenchScript(vm, "Func global (int, int)", _SC(" \
+        local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = Add(i, 1); \
+        "));
+    BenchScript(vm, "FuncUnchecked global (int, int)", _SC(" \
+        local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = AddUnchecked(i, 1); \
+        "));
+    BenchScript(vm, "Func member (float, float, float)", _SC(" \
+        local p = Particle(); \
+        for (local i = 0; i < 1000000; ++i) p.Move(1.0, 2.0, 3.0); \
+        "));
+    BenchScript(vm, "FuncUnchecked member (float, float, float)", _SC(" \
+        local p = Particle(); \
+        for (local i = 0; i < 1000000; ++i) p.MoveUnchecked(1.0, 2.0, 3.0); \
+        "));
+    BenchScript(vm, "Func const member ()", _SC(" \
+        local p = Particle(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = p.X(); \
+        "));
+    BenchScript(vm, "FuncUnchecked const member ()", _SC(" \
+        local p = Particle(); local x = 0; \
+        for (local i = 0; i < 1000000; ++i) x = p.XUnchecked(); \
+        "));
+
+    sq_close(vm);
+    return 0;
+}
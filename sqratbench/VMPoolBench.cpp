@@ -0,0 +1,66 @@
+//
+// VMPoolBench: cost of getting a ready to use VM for a script job, created per job or taken from a SqratVMPool
+//
+
+#include "Bench.h"
+#include <sqrat/sqratVM.h>
+#include <sqrat/sqratVMPool.h>
+
+using namespace Sqrat;
+
+class Job {
+public:
+    Job() : done(0) {}
+    int Step(int n) { return done += n; }
+    int Done() const { return done; }
+    int done;
+};
+
+// Binds a small API and runs a bootstrap script like a typical embedder would
+static void InitVM(SqratVM& vm) {
+    Class<Job> job(vm.GetVM(), _SC("Job"));
+    job.Func(_SC("Step"), &Job::Step)
+       .Func(_SC("Done"), &Job::Done)
+       .Var(_SC("done"), &Job::done);
+    RootTable(vm.GetVM()).Bind(_SC("Job"), job);
+    vm.DoString(_SC("function helper(n) { return n * 2; }"));
+}
+
+static const SQChar* JOB_SCRIPT = _SC(" \
+    local j = Job(); \
+    for (local i = 0; i < 10; ++i) j.Step(helper(i)); \
+    result <- j.Done(); \
+    ");
+
+static const long JOBS = 500;
+
+int main() {
+    {
+        SqratBench::Timer timer;
+        for (long i = 0; i < JOBS; ++i) {
+            SqratVM vm;
+            InitVM(vm);
+            vm.DoString(JOB_SCRIPT);
+        }
+        SqratBench::Report("new SqratVM + init per job", JOBS, timer.Seconds());
+    }
+
+    {
+        SqratVMPool pool(4, &InitVM);
+        SqratBench::Timer timer;
+        for (long i = 0; i < JOBS; ++i) {
+            SqratVM* vm = pool.Acquire();
+            vm->DoString(JOB_SCRIPT);
+            pool.Release(vm);
+        }
+        SqratBench::Report("SqratVMPool Acquire + Release per job", JOBS, timer.Seconds());
+
+        VMPoolStats stats = pool.GetStats();
+        SqratBench::Report("  checkout", long(stats.checkouts), stats.checkoutTime);
+        SqratBench::Report("  reset", long(stats.resets), stats.resetTime);
+        printf("%-12s %-40s %12lu reuses %lu misses\n", SQRAT_BENCH_VARIANT, "  pool", (unsigned long)stats.reuses,
+            (unsigned long)stats.misses);
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+//
+// ZygoteBench: wall time of running a script file in a fully bound VM, cold or in a child forked by a SqratZygote
+//
+
+#include "Bench.h"
+#include <sqrat/sqratVM.h>
+#include <sqrat/sqratZygote.h>
+
+#include <sys/time.h>
+
+using namespace Sqrat;
+
+// Processor time does not include the children, so this benchmark measures wall time
+class WallTimer {
+public:
+    WallTimer() : start(Now()) {}
+
+    double Seconds() const {
+        return Now() - start;
+    }
+
+private:
+    static double Now() {
+        timeval tv;
+        gettimeofday(&tv, NULL);
+        return tv.tv_sec + tv.tv_usec * 1e-6;
+    }
+
+    double start;
+};
+
+template <int N>
+class Service {
+public:
+    Service() : calls(0) {}
+    int Call(int n) { return calls += n; }
+    int calls;
+};
+
+// Binds Service<0> to Service<N - 1> and a bootstrap that builds some script state, like a typical batch worker
+template <int N>
+struct BindServices {
+    static void Bind(HSQUIRRELVM vm) {
+        BindServices<N - 1>::Bind(vm);
+        SQChar name[32];
+        scsprintf(name, _SC("Service%d"), N - 1);
+        Class<Service<N - 1> > cls(vm, name);
+        cls.Func(_SC("Call"), &Service<N - 1>::Call)
+           .Var(_SC("calls"), &Service<N - 1>::calls);
+        RootTable(vm).Bind(name, cls);
+    }
+};
+
+template <>
+struct BindServices<0> {
+    static void Bind(HSQUIRRELVM) {}
+};
+
+static const SQChar* BOOTSTRAP = _SC(" \
+    config <- {}; \
+    for (local i = 0; i < 2000; ++i) config[\"key\" + i] <- i; \
+    function work(n) { local s = Service0(); for (local i = 0; i < n; ++i) s.Call(i); return s.calls; } \
+    ");
+
+static void InitVM(SqratVM& vm) {
+    BindServices<32>::Bind(vm.GetVM());
+    vm.DoString(BOOTSTRAP);
+}
+
+static const long JOBS = 200;
+
+int main() {
+    const char* job = "zygote_bench_job.nut";
+    FILE* file = fopen(job, "w");
+    if (file == NULL) {
+        return 1;
+    }
+    fputs("work(100);", file);
+    fclose(file);
+
+    {
+        WallTimer timer;
+        for (long i = 0; i < JOBS; ++i) {
+            SqratVM vm;
+            InitVM(vm);
+            vm.DoFile(_SC("zygote_bench_job.nut"));
+        }
+        SqratBench::Report("cold SqratVM + init + DoFile", JOBS, timer.Seconds());
+    }
+
+    {
+        SqratZygote zygote(&InitVM);
+        WallTimer start;
+        if (zygote.Start() != SqratVM::SQRAT_NO_ERROR) {
+            return 1;
+        }
+        SqratBench::Report("SqratZygote::Start (once)", 1, start.Seconds());
+
+        WallTimer timer;
+        for (long i = 0; i < JOBS; ++i) {
+            zygote.DoFile(_SC("zygote_bench_job.nut"));
+        }
+        SqratBench::Report("SqratZygote::DoFile (fork per job)", JOBS, timer.Seconds());
+    }
+
+    remove(job);
+    return 0;
+}
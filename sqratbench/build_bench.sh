@@ -0,0 +1,24 @@
+#!/bin/sh -ex
+
+# Builds every benchmark twice: once as is and once with the variant flags
+# (SCRAT_NO_VM_DATA by default) so that run_bench.sh can compare both
+
+SQUIRREL_INCLUDE=/usr/local/include/squirrel
+SQUIRREL_LIB=/usr/local/lib
+CFLAGS="-O2 -DNDEBUG -I. -I../include -I${SQUIRREL_INCLUDE}"
+VARIANT_CFLAGS=${VARIANT_CFLAGS:-"-DSCRAT_NO_VM_DATA"}
+LDFLAGS=-L${SQUIRREL_LIB}
+LIBS="-lsqstdlib -lsquirrel -lstdc++ -lm"
+
+mkdir -p bin
+
+BENCH_CPPS="ClassDataBench.cpp AllocatorBench.cpp InstanceTrackingBench.cpp AccessorBench.cpp OverloadBench.cpp UncheckedBench.cpp StringBench.cpp KeyBench.cpp CallbackBench.cpp BatchBench.cpp BindingBench.cpp VMPoolBench.cpp ZygoteBench.cpp BytecodeCacheBench.cpp ErrorBench.cpp"
+
+for f in $BENCH_CPPS; do
+    gcc $CFLAGS \
+    ${f} \
+    -o bin/${f%.cpp}  ${LDFLAGS} ${LIBS}
+    gcc $CFLAGS -DSQRAT_BENCH_VARIANT_BUILD ${VARIANT_CFLAGS} \
+    ${f} \
+    -o bin/${f%.cpp}_variant  ${LDFLAGS} ${LIBS}
+done
@@ -0,0 +1,23 @@
+#!/bin/sh -e
+
+# Compiles BindingSizeBench.cpp with the expanded binding engine and with the variadic one
+# (SCRAT_USE_CXX11_OPTIMIZATIONS) and reports the compile time and the size of the object of each
+
+SQUIRREL_INCLUDE=/usr/local/include/squirrel
+CXX=${CXX:-g++}
+CFLAGS="-std=c++11 -O2 -DNDEBUG -I. -I../include -I${SQUIRREL_INCLUDE} ${BENCH_CFLAGS}"
+
+mkdir -p bin
+
+compile() {
+    name=$1
+    shift
+    start=$(date +%s.%N)
+    ${CXX} ${CFLAGS} "$@" -c BindingSizeBench.cpp -o bin/BindingSizeBench_${name}.o
+    end=$(date +%s.%N)
+    bytes=$(size bin/BindingSizeBench_${name}.o | awk 'NR == 2 { print $1 + $2 + $3 }')
+    printf "%-12s %-40s %8.2f s %10d bytes\n" ${name} "compile BindingSizeBench.cpp" $(awk "BEGIN { print ${end} - ${start} }") ${bytes}
+}
+
+compile expanded
+compile variadic -DSCRAT_USE_CXX11_OPTIMIZATIONS
@@ -0,0 +1,5 @@
+#!/bin/sh -x
+
+for f in bin/*; do
+    ${f}
+done
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+using namespace Sqrat;
+
+class ReplayShape {
+public:
+    ReplayShape() : sides(0), scale(1) {}
+    ReplayShape(int s) : sides(s), scale(1) {}
+    virtual ~ReplayShape() {}
+
+    int Sides() const { return sides; }
+    int Grow(int n) { return sides += n; }
+    int Grow(int n, int m) { return sides += n * m; }
+    float GetScale() const { return scale; }
+    void SetScale(float s) { scale = s; }
+    static int Count() { return 42; }
+
+    int sides;
+    float scale;
+};
+
+class ReplaySquare : public ReplayShape {
+public:
+    ReplaySquare() : ReplayShape(4) {}
+    int Area() const { return 16; }
+};
+
+static int ReplayAdd(int a, int b) {
+    return a + b;
+}
+
+static SQInteger ReplayRaw(HSQUIRRELVM v) {
+    sq_pushinteger(v, 7);
+    return 1;
+}
+
+static void BindReplayApi(HSQUIRRELVM v) {
+    Class<ReplayShape> shape(v, _SC("ReplayShape"));
+    shape.Ctor()
+        .Ctor<int>()
+        .Func(_SC("Sides"), &ReplayShape::Sides)
+        .Overload<int (ReplayShape::*)(int)>(_SC("Grow"), &ReplayShape::Grow)
+        .Overload<int (ReplayShape::*)(int, int)>(_SC("Grow"), &ReplayShape::Grow)
+        .Prop(_SC("scale"), &ReplayShape::GetScale, &ReplayShape::SetScale)
+        .Var(_SC("sides"), &ReplayShape::sides)
+        .StaticFunc(_SC("Count"), &ReplayShape::Count)
+        .SquirrelFunc(_SC("Raw"), &ReplayRaw)
+        .SetStaticValue(_SC("kind"), _SC("shape"));
+    RootTable(v).Bind(_SC("ReplayShape"), shape);
+
+    DerivedClass<ReplaySquare, ReplayShape> square(v, _SC("ReplaySquare"));
+    square.Func(_SC("Area"), &ReplaySquare::Area);
+    RootTable(v).Bind(_SC("ReplaySquare"), square);
+
+    RootTable(v).Func(_SC("ReplayAdd"), &ReplayAdd)
+                .SetValue(_SC("replayVersion"), 3);
+}
+
+static void BindNamespace(HSQUIRRELVM v) {
+    Table ns(v);
+    ns.Func(_SC("ReplayAdd"), &ReplayAdd);
+    RootTable(v).Bind(_SC("ns"), ns);
+}
+
+static bool RunReplayScript(HSQUIRRELVM v, const SQChar* code) {
+    Script script(v);
+    string err;
+    if (!script.CompileString(code, err)) {
+        ADD_FAILURE() << _SC("Compile Failed: ") << err;
+        return false;
+    }
+    if (!script.Run(err)) {
+        ADD_FAILURE() << _SC("Run Failed: ") << err;
+        return false;
+    }
+    return true;
+}
+
+TEST_F(SqratTest, BindingReplay) {
+    BindingSet api;
+    api.Record(&BindReplayApi);
+    EXPECT_TRUE(api.IsComplete());
+    EXPECT_GT(api.GetSize(), 10u);
+
+    DefaultVM::Set(vm);
+    api.Apply(vm);
+
+    EXPECT_TRUE(RunReplayScript(vm, _SC(" \
+        local s = ReplayShape(3); \
+        gTest.EXPECT_INT_EQ(s.Sides(), 3); \
+        gTest.EXPECT_INT_EQ(ReplayShape().Sides(), 0); \
+        gTest.EXPECT_INT_EQ(s.Grow(1), 4); \
+        gTest.EXPECT_INT_EQ(s.Grow(2, 3), 10); \
+        s.scale = 2.5; \
+        gTest.EXPECT_FLOAT_EQ(s.scale, 2.5); \
+        s.sides = 5; \
+        gTest.EXPECT_INT_EQ(s.sides, 5); \
+        gTest.EXPECT_INT_EQ(ReplayShape.Count(), 42); \
+        gTest.EXPECT_INT_EQ(s.Raw(), 7); \
+        gTest.EXPECT_STR_EQ(ReplayShape.kind, \"shape\"); \
+        local q = ReplaySquare(); \
+        gTest.EXPECT_INT_EQ(q.Sides(), 4); \
+        gTest.EXPECT_INT_EQ(q.Area(), 16); \
+        gTest.EXPECT_TRUE(q instanceof ReplayShape); \
+        gTest.EXPECT_INT_EQ(ReplayAdd(2, 3), 5); \
+        gTest.EXPECT_INT_EQ(replayVersion, 3); \
+        ")));
+
+    ReplaySquare square;
+    PushVar(vm, &square);
+    EXPECT_EQ(static_cast<ReplayShape*>(&square), Var<ReplayShape*>(vm, -1).value);
+    sq_pop(vm, 1);
+
+    // the same recording can be applied to any number of VMs
+    HSQUIRRELVM other = sq_open(1024);
+    api.Apply(other);
+    EXPECT_TRUE(ClassType<ReplaySquare>::hasClassData(other));
+    EXPECT_NE(ClassType<ReplaySquare>::getClassData(vm), ClassType<ReplaySquare>::getClassData(other));
+    sq_close(other);
+}
+
+TEST_F(SqratTest, BindingReplayIncomplete) {
+    BindingSet api;
+    api.Record(&BindNamespace);
+    EXPECT_FALSE(api.IsComplete()); // functions bound in other tables than the root table are not recorded
+    EXPECT_EQ(0u, api.GetSize());
+}
+
+class ReplayHandle {
+public:
+    int Id() const { return 9; }
+};
+
+static void BindUntracked(HSQUIRRELVM v) {
+    Class<ReplayHandle> handle(v, _SC("ReplayHandle"));
+    handle.TrackInstances(false)
+        .Func(_SC("Id"), &ReplayHandle::Id);
+    RootTable(v).Bind(_SC("ReplayHandle"), handle);
+}
+
+TEST_F(SqratTest, BindingReplayTrackInstances) {
+    BindingSet api;
+    api.Record(&BindUntracked);
+    EXPECT_TRUE(api.IsComplete());
+
+    DefaultVM::Set(vm);
+    api.Apply(vm);
+    EXPECT_TRUE(ClassType<ReplayHandle>::getClassData(vm)->instances.Get() == NULL);
+
+    EXPECT_TRUE(RunReplayScript(vm, _SC(" \
+        gTest.EXPECT_INT_EQ(ReplayHandle().Id(), 9); \
+        ")));
+
+    // pushing the same object twice gives two instances since it is not tracked
+    ReplayHandle handle;
+    PushVar(vm, &handle);
+    PushVar(vm, &handle);
+    EXPECT_NE(0, sq_cmp(vm));
+    sq_pop(vm, 2);
+}
@@ -395,6 +395,102 @@ TEST_F(SqratTest, InheritedClassBinding)
     }
 }
 
+// Padding bases give every level of the hierarchy a non-zero pointer adjustment
+struct Padding1 { int pad1; Padding1() : pad1(1) {} virtual ~Padding1() {} };
+struct Padding2 { int pad2; Padding2() : pad2(2) {} virtual ~Padding2() {} };
+struct Padding3 { int pad3; Padding3() : pad3(3) {} virtual ~Padding3() {} };
+
+class Level0 {
+public:
+    Level0() : level0(0) {}
+    virtual ~Level0() {}
+    int level0;
+};
+
+class Level1 : public Padding1, public Level0 {
+public:
+    Level1() : level1(1) {}
+    int level1;
+};
+
+class Level2 : public Padding2, public Level1 {
+public:
+    Level2() : level2(2) {}
+    int level2;
+};
+
+class Level3 : public Padding3, public Level2 {
+public:
+    Level3() : level3(3) {}
+    int level3;
+};
+
+int GetLevel0(Level0* l) {
+    return l->level0;
+}
+
+int GetLevel1(Level1* l) {
+    return l->level1;
+}
+
+int GetLevel2(Level2* l) {
+    return l->level2;
+}
+
+TEST_F(SqratTest, DeepInheritanceCasts)
+{
+    DefaultVM::Set(vm);
+
+    Class<Level0> level0(vm, _SC("Level0"));
+    RootTable().Bind(_SC("Level0"), level0);
+    DerivedClass<Level1, Level0> level1(vm, _SC("Level1"));
+    RootTable().Bind(_SC("Level1"), level1);
+    DerivedClass<Level2, Level1> level2(vm, _SC("Level2"));
+    RootTable().Bind(_SC("Level2"), level2);
+    DerivedClass<Level3, Level2> level3(vm, _SC("Level3"));
+    RootTable().Bind(_SC("Level3"), level3);
+
+    RootTable().Func(_SC("GetLevel0"), &GetLevel0);
+    RootTable().Func(_SC("GetLevel1"), &GetLevel1);
+    RootTable().Func(_SC("GetLevel2"), &GetLevel2);
+
+    Script script;
+
+    script.CompileString(_SC(" \
+        class ScriptLevel extends Level3 { \
+            constructor() { \
+                base.constructor(); \
+            } \
+        } \
+        \
+        local l3 = Level3(); \
+        gTest.EXPECT_INT_EQ(GetLevel0(l3), 0); \
+        gTest.EXPECT_INT_EQ(GetLevel1(l3), 1); \
+        gTest.EXPECT_INT_EQ(GetLevel2(l3), 2); \
+        \
+        local l1 = Level1(); \
+        gTest.EXPECT_INT_EQ(GetLevel0(l1), 0); \
+        gTest.EXPECT_INT_EQ(GetLevel1(l1), 1); \
+        \
+        for (local i = 0; i < 2; ++i) { /* the second pass uses the type tag cached on ScriptLevel */ \
+            local s = ScriptLevel(); \
+            gTest.EXPECT_INT_EQ(GetLevel0(s), 0); \
+            gTest.EXPECT_INT_EQ(GetLevel1(s), 1); \
+            gTest.EXPECT_INT_EQ(GetLevel2(s), 2); \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm))
+    {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm))
+    {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
+
 class NativeObj
 {
 public:
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+#include <thread>
+#include <vector>
+#endif
+
+using namespace Sqrat;
+
+class CachedCounter {
+public:
+    CachedCounter() : count(0) {}
+    int Increment() { return ++count; }
+    int count;
+};
+
+static void BindCachedCounter(HSQUIRRELVM v) {
+    Class<CachedCounter> cls(v, _SC("CachedCounter"));
+    cls.Func(_SC("Increment"), &CachedCounter::Increment);
+    cls.Var(_SC("count"), &CachedCounter::count);
+    RootTable(v).Bind(_SC("CachedCounter"), cls);
+}
+
+static bool RunCounterScript(HSQUIRRELVM v, int expected) {
+    Script script(v);
+    string err;
+    if (!script.CompileString(_SC(" \
+        local c = CachedCounter(); \
+        for (local i = 0; i < 10; ++i) c.Increment(); \
+        result <- c.count; \
+        "), err)) {
+        ADD_FAILURE() << _SC("Compile Failed: ") << err;
+        return false;
+    }
+    if (!script.Run(err)) {
+        ADD_FAILURE() << _SC("Run Failed: ") << err;
+        return false;
+    }
+    SharedPtr<int> result = RootTable(v).GetValue<int>(_SC("result"));
+    return result.Get() != NULL && *result == expected;
+}
+
+TEST_F(SqratTest, ClassDataCacheMultipleVMs) {
+    BindCachedCounter(vm);
+
+    HSQUIRRELVM other = sq_open(1024);
+    BindCachedCounter(other);
+
+    EXPECT_TRUE(RunCounterScript(vm, 10));
+    EXPECT_TRUE(RunCounterScript(other, 10));
+
+    // every VM must get its own class data even though the C++ type is shared
+    EXPECT_NE(ClassType<CachedCounter>::getClassData(vm), ClassType<CachedCounter>::getClassData(other));
+
+    sq_close(other);
+
+    // a VM created after another one was closed must not see its stale class data
+    HSQUIRRELVM third = sq_open(1024);
+    EXPECT_FALSE(ClassType<CachedCounter>::hasClassData(third));
+    BindCachedCounter(third);
+    EXPECT_TRUE(RunCounterScript(third, 10));
+    sq_close(third);
+
+    EXPECT_TRUE(RunCounterScript(vm, 10));
+}
+
+TEST_F(SqratTest, ClassDataCacheThreads) {
+    BindCachedCounter(vm);
+
+    HSQUIRRELVM thread = sq_newthread(vm, 1024);
+    HSQOBJECT threadObj;
+    sq_getstackobj(vm, -1, &threadObj);
+    sq_addref(vm, &threadObj);
+    sq_pop(vm, 1);
+
+    // threads share the registry table of their VM so they must share its class data as well
+    EXPECT_TRUE(ClassType<CachedCounter>::hasClassData(thread));
+    EXPECT_EQ(ClassType<CachedCounter>::getClassData(vm), ClassType<CachedCounter>::getClassData(thread));
+
+    CachedCounter counter;
+    PushVar(thread, &counter);
+    EXPECT_EQ(&counter, Var<CachedCounter*>(thread, -1).value);
+    sq_pop(thread, 1);
+
+    sq_release(vm, &threadObj);
+}
+
+class CachedOther {
+};
+
+static int ReadCount(CachedCounter* counter) {
+    return counter->count;
+}
+
+TEST_F(SqratTest, ClassDataCacheTypeCheck) {
+    DefaultVM::Set(vm);
+    BindCachedCounter(vm);
+    Class<CachedOther> other(vm, _SC("CachedOther"));
+    RootTable(vm).Bind(_SC("CachedOther"), other);
+    RootTable(vm).Func(_SC("ReadCount"), &ReadCount);
+
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        class ScriptCounter extends CachedCounter { \
+            constructor() { base.constructor(); } \
+        } \
+        local c = ScriptCounter(); \
+        c.Increment(); \
+        gTest.EXPECT_INT_EQ(ReadCount(c), 1); \
+        local threw = false; \
+        try { \
+            ReadCount(CachedOther()); \
+        } catch (e) { \
+            threw = true; \
+        } \
+        gTest.EXPECT_TRUE(threw); \
+        gTest.EXPECT_INT_EQ(ReadCount(c), 1); \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+
+    // finding the native base of the Squirrel class must not change the type tag of the class
+    SQUserPointer typeTag = &typeTag;
+    sq_pushroottable(vm);
+    sq_pushstring(vm, _SC("ScriptCounter"), -1);
+    ASSERT_TRUE(SQ_SUCCEEDED(sq_get(vm, -2)));
+    sq_gettypetag(vm, -1, &typeTag);
+    sq_pop(vm, 2);
+    EXPECT_TRUE(typeTag == NULL);
+}
+
+TEST_F(SqratTest, ClassDataCacheManyScriptClasses) {
+    DefaultVM::Set(vm);
+    BindCachedCounter(vm);
+    RootTable(vm).Func(_SC("ReadCount"), &ReadCount);
+
+    // more classes than the data of the VM caches, so some are evicted (and released) while others are being created
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        for (local i = 0; i < 200; ++i) { \
+            local ScriptCounter = class extends CachedCounter { \
+                constructor() { base.constructor(); } \
+            }; \
+            local c = ScriptCounter(); \
+            c.Increment(); \
+            gTest.EXPECT_INT_EQ(ReadCount(c), 1); \
+            gTest.EXPECT_INT_EQ(ReadCount(c), 1); \
+        } \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+}
+
+class RegisteredShape {
+public:
+    RegisteredShape() : sides(3) {}
+    int sides;
+};
+
+static void BindRegisteredShape(HSQUIRRELVM v) {
+    Class<RegisteredShape> cls(v, _SC("RegisteredShape"));
+    cls.Var(_SC("sides"), &RegisteredShape::sides);
+    RootTable(v).Bind(_SC("RegisteredShape"), cls);
+}
+
+TEST_F(SqratTest, ClassDataCacheStaticRegistry) {
+    // the registry lives as long as the process, so the class may be registered already (by an earlier --gtest_repeat
+    // iteration or another test)
+    AbstractStaticClassData* prior = ClassType<RegisteredShape>::getStaticClassData();
+    EXPECT_NE(ClassType<RegisteredShape>::getClassSlot(), ClassType<CachedCounter>::getClassSlot());
+
+    HSQUIRRELVM other = sq_open(1024);
+    BindRegisteredShape(vm);
+    BindRegisteredShape(other);
+
+    // the static data (and so the type tag) is registered once and shared by every VM
+    AbstractStaticClassData* staticData = ClassType<RegisteredShape>::getStaticClassData();
+    ASSERT_TRUE(staticData != NULL);
+    if (prior != NULL) {
+        EXPECT_EQ(prior, staticData);
+    }
+    EXPECT_EQ(staticData, ClassType<RegisteredShape>::getClassData(vm)->staticData);
+    EXPECT_EQ(staticData, ClassType<RegisteredShape>::getClassData(other)->staticData);
+    EXPECT_EQ(string(_SC("RegisteredShape")), ClassType<RegisteredShape>::ClassName());
+
+    // and stays registered after the VMs that bound it are closed
+    sq_close(other);
+    EXPECT_EQ(staticData, ClassType<RegisteredShape>::getStaticClassData());
+}
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+static void BindOnOwnVM(HSQUIRRELVM* v) {
+    *v = sq_open(1024);
+    BindCachedCounter(*v);
+    BindRegisteredShape(*v);
+}
+
+TEST_F(SqratTest, ClassDataCacheConcurrentBinding) {
+    // one VM per thread, all binding the same classes at the same time
+    HSQUIRRELVM vms[8];
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.push_back(std::thread(&BindOnOwnVM, &vms[i]));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    AbstractStaticClassData* staticData = ClassType<CachedCounter>::getStaticClassData();
+    ASSERT_TRUE(staticData != NULL);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(staticData, ClassType<CachedCounter>::getClassData(vms[i])->staticData);
+        EXPECT_TRUE(RunCounterScript(vms[i], 10));
+        sq_close(vms[i]);
+    }
+}
+#endif
+
+#if !defined(SCRAT_VM_DATA_IN_FOREIGN_PTR)
+TEST_F(SqratTest, ClassDataCacheKeepsForeignPtr) {
+    static int embedderData = 0;
+    sq_setforeignptr(vm, &embedderData);
+
+    // the data of Sqrat lives in the registry table so the foreign pointer of the embedder must survive binding and calls
+    BindCachedCounter(vm);
+    EXPECT_TRUE(RunCounterScript(vm, 10));
+    EXPECT_EQ(&embedderData, sq_getforeignptr(vm));
+
+    sq_setforeignptr(vm, NULL);
+}
+#endif
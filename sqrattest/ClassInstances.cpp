@@ -512,3 +512,74 @@ TEST_F(SqratTest, SimpleTypeChecking) {
 }
 
     
+
+class TrackedItem {
+public:
+    int id;
+};
+
+class UntrackedItem {
+public:
+    int id;
+};
+
+static TrackedItem trackedItem;
+static UntrackedItem untrackedItem;
+
+static TrackedItem* GetTrackedItem() {
+    return &trackedItem;
+}
+
+static UntrackedItem* GetUntrackedItem() {
+    return &untrackedItem;
+}
+
+TEST_F(SqratTest, InstanceTracking) {
+    DefaultVM::Set(vm);
+
+    Class<TrackedItem> tracked(vm, _SC("TrackedItem"));
+    tracked.Var(_SC("id"), &TrackedItem::id);
+    RootTable().Bind(_SC("TrackedItem"), tracked);
+
+    Class<UntrackedItem> untracked(vm, _SC("UntrackedItem"));
+    untracked.TrackInstances(false)
+        .Var(_SC("id"), &UntrackedItem::id);
+    RootTable().Bind(_SC("UntrackedItem"), untracked);
+
+    RootTable().Func(_SC("GetTrackedItem"), &GetTrackedItem);
+    RootTable().Func(_SC("GetUntrackedItem"), &GetUntrackedItem);
+
+    EXPECT_TRUE(ClassType<UntrackedItem>::getClassData(vm)->instances.Get() == NULL);
+
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        gTest.EXPECT_TRUE(GetTrackedItem() == GetTrackedItem()); \
+        gTest.EXPECT_FALSE(GetUntrackedItem() == GetUntrackedItem()); \
+        \
+        local a = GetUntrackedItem(); \
+        local b = GetUntrackedItem(); \
+        a.id = 42; \
+        gTest.EXPECT_INT_EQ(b.id, 42); \
+        \
+        local items = []; \
+        for (local i = 0; i < 100; ++i) items.append(UntrackedItem()); \
+        items.clear(); \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+
+    // turning tracking back on only affects instances created from then on
+    untracked.TrackInstances(true);
+    PushVar(vm, &untrackedItem);
+    PushVar(vm, &untrackedItem);
+    SQUserPointer first, second;
+    sq_getinstanceup(vm, -2, &first, 0);
+    sq_getinstanceup(vm, -1, &second, 0);
+    EXPECT_EQ(first, second); // the same instance was pushed twice
+    EXPECT_EQ(1u, ClassType<UntrackedItem>::getClassData(vm)->instances->Size());
+    sq_pop(vm, 2);
+}
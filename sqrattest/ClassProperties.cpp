@@ -120,4 +120,149 @@ TEST_F(SqratTest, ClassProperties) {
     if (Sqrat::Error::Occurred(vm)) {
         FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
     }
-}
\ No newline at end of file
+}
+class Gauge {
+public:
+    Gauge() : level(1), scale(2.5f), unit(_SC("m")) {}
+
+    int GetDoubled() const { return level * 2; }
+    void SetDoubled(int v) { level = v / 2; }
+
+    int level;
+    float scale;
+    string unit;
+
+    static int count;
+};
+
+int Gauge::count = 3;
+
+class PressureGauge : public Gauge {
+public:
+    PressureGauge() : limit(100) {}
+    int limit;
+};
+
+static int GetNegated(const Gauge* g) {
+    return -g->level;
+}
+
+static void SetNegated(Gauge* g, int v) {
+    g->level = -v;
+}
+
+TEST_F(SqratTest, ClassAccessorDescriptors) {
+    DefaultVM::Set(vm);
+
+    Class<Gauge> gauge(vm, _SC("Gauge"));
+    gauge.Var(_SC("level"), &Gauge::level)
+        .Var(_SC("scale"), &Gauge::scale)
+        .Var(_SC("unit"), &Gauge::unit)
+        .StaticVar(_SC("count"), &Gauge::count)
+        .Prop(_SC("doubled"), &Gauge::GetDoubled, &Gauge::SetDoubled)
+        .GlobalProp(_SC("negated"), &GetNegated, &SetNegated);
+    RootTable().Bind(_SC("Gauge"), gauge);
+
+    DerivedClass<PressureGauge, Gauge> pressure(vm, _SC("PressureGauge"));
+    pressure.Var(_SC("limit"), &PressureGauge::limit);
+    RootTable().Bind(_SC("PressureGauge"), pressure);
+
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        local g = Gauge(); \
+        gTest.EXPECT_INT_EQ(g.level, 1); \
+        g.level = 4; \
+        gTest.EXPECT_INT_EQ(g.level, 4); \
+        gTest.EXPECT_FLOAT_EQ(g.scale, 2.5); \
+        g.unit = \"km\"; \
+        gTest.EXPECT_STR_EQ(g.unit, \"km\"); \
+        gTest.EXPECT_INT_EQ(g.count, 3); \
+        g.count = 9; \
+        gTest.EXPECT_INT_EQ(g.count, 9); \
+        gTest.EXPECT_INT_EQ(g.doubled, 8); \
+        g.doubled = 20; \
+        gTest.EXPECT_INT_EQ(g.level, 10); \
+        gTest.EXPECT_INT_EQ(g.negated, -10); \
+        g.negated = 6; \
+        gTest.EXPECT_INT_EQ(g.level, -6); \
+        \
+        local p = PressureGauge(); \
+        p.level = 7; \
+        gTest.EXPECT_INT_EQ(p.doubled, 14); \
+        gTest.EXPECT_INT_EQ(p.negated, -7); \
+        gTest.EXPECT_INT_EQ(p.limit, 100); \
+        \
+        local threw = false; \
+        try { g.level = \"not a number\"; } catch (e) { threw = true; } \
+        gTest.EXPECT_TRUE(threw); \
+        threw = false; \
+        try { local x = g.missing; } catch (e) { threw = true; } \
+        gTest.EXPECT_TRUE(threw); \
+        \
+        Gauge.__getTable.answer <- function() { return 42; }; \
+        gTest.EXPECT_INT_EQ(g.answer, 42); \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+    EXPECT_EQ(9, Gauge::count);
+}
+
+class Vec3Fields {
+public:
+    Vec3Fields() : x(0), y(0), z(0), visible(true) {}
+    float x, y, z;
+    bool visible;
+    string label;
+};
+
+TEST_F(SqratTest, ClassFieldAccessors) {
+    DefaultVM::Set(vm);
+
+    Class<Vec3Fields> vec(vm, _SC("Vec3Fields"));
+    vec.Var<float, &Vec3Fields::x>(_SC("x"))
+        .Var<float, &Vec3Fields::y>(_SC("y"))
+        .ConstVar<float, &Vec3Fields::z>(_SC("z"))
+        .Var<bool, &Vec3Fields::visible>(_SC("visible"))
+        .Var<string, &Vec3Fields::label>(_SC("label"));
+    RootTable().Bind(_SC("Vec3Fields"), vec);
+
+    Vec3Fields native;
+    native.z = 3.0f;
+    RootTable().SetInstance(_SC("native"), &native);
+
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        local v = Vec3Fields(); \
+        v.x = 1.5; \
+        v.y = v.x * 2; \
+        gTest.EXPECT_FLOAT_EQ(v.x, 1.5); \
+        gTest.EXPECT_FLOAT_EQ(v.y, 3.0); \
+        gTest.EXPECT_FLOAT_EQ(v.z, 0.0); \
+        gTest.EXPECT_TRUE(v.visible); \
+        v.visible = false; \
+        gTest.EXPECT_FALSE(v.visible); \
+        v.label = \"origin\"; \
+        gTest.EXPECT_STR_EQ(v.label, \"origin\"); \
+        \
+        native.x = 10; \
+        gTest.EXPECT_FLOAT_EQ(native.z, 3.0); \
+        \
+        local threw = false; \
+        try { v.z = 1.0; } catch (e) { threw = true; } \
+        gTest.EXPECT_TRUE(threw); \
+        threw = false; \
+        try { v.x = \"text\"; } catch (e) { threw = true; } \
+        gTest.EXPECT_TRUE(threw); \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+    EXPECT_FLOAT_EQ(10.0f, native.x);
+}
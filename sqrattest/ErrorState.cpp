@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+using namespace Sqrat;
+
+#if !defined (SCRAT_NO_ERROR_CHECKING) && !defined (SCRAT_USE_EXCEPTIONS)
+TEST_F(SqratTest, ErrorStatePerVM) {
+    HSQUIRRELVM other = sq_open(1024);
+    HSQUIRRELVM thread = sq_newthread(vm, 1024);
+    HSQOBJECT threadObj;
+    sq_getstackobj(vm, -1, &threadObj);
+    sq_addref(vm, &threadObj);
+    sq_pop(vm, 1);
+
+    SQInteger top = sq_gettop(vm);
+    EXPECT_FALSE(Error::Occurred(vm));
+    Error::Throw(vm, _SC("first"));
+    Error::Throw(vm, _SC("second"));
+    EXPECT_EQ(top, sq_gettop(vm));
+
+    // the error belongs to the VM and its threads only, and the first one raised is the one reported
+    EXPECT_TRUE(Error::Occurred(vm));
+    EXPECT_TRUE(Error::Occurred(thread));
+    EXPECT_FALSE(Error::Occurred(other));
+    EXPECT_EQ(string(_SC("first")), Error::Message(thread));
+    EXPECT_FALSE(Error::Occurred(vm));
+
+    Error::Throw(other, _SC("other"));
+    EXPECT_FALSE(Error::Occurred(vm));
+    Error::Clear(other);
+    EXPECT_FALSE(Error::Occurred(other));
+
+    sq_release(vm, &threadObj);
+    sq_close(other);
+}
+#endif
@@ -191,3 +191,56 @@ TEST_F(SqratTest, FunctionOfSameNumberOfArgumentsButDifferentTypesBinding) {
     }
 
 }
+
+static int ViewLength(StringView s)
+{
+    return static_cast<int>(s.Size());
+}
+
+static bool ViewEquals(const StringView& a, const StringView& b)
+{
+    return a == b;
+}
+
+static string ViewCopy(StringView s)
+{
+    return s.ToString();
+}
+
+static StringView ViewEcho(StringView s)
+{
+    return s; // the argument is still on the stack while the return value is pushed
+}
+
+TEST_F(SqratTest, StringViewArguments) {
+    DefaultVM::Set(vm);
+
+    RootTable().Func(_SC("ViewLength"), &ViewLength);
+    RootTable().Func(_SC("ViewEquals"), &ViewEquals);
+    RootTable().Func(_SC("ViewCopy"), &ViewCopy);
+    RootTable().Func(_SC("ViewEcho"), &ViewEcho);
+
+    Script script;
+    script.CompileString(_SC(" \
+        gTest.EXPECT_INT_EQ(5, ViewLength(\"hello\")); \
+        gTest.EXPECT_INT_EQ(0, ViewLength(\"\")); \
+        gTest.EXPECT_INT_EQ(3, ViewLength(123)); /* values that are not strings are converted */ \
+        gTest.EXPECT_TRUE(ViewEquals(\"abc\", \"abc\")); \
+        gTest.EXPECT_FALSE(ViewEquals(\"abc\", \"abd\")); \
+        gTest.EXPECT_TRUE(ViewEquals(\"1.5\", 1.5)); \
+        gTest.EXPECT_STR_EQ(\"copied\", ViewCopy(\"copied\")); \
+        gTest.EXPECT_STR_EQ(\"echo\", ViewEcho(\"echo\")); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    StringView empty;
+    EXPECT_TRUE(empty.Empty());
+    EXPECT_TRUE(StringView(_SC("abc")) == StringView(_SC("abcdef"), 3));
+}
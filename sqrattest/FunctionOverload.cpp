@@ -284,3 +284,226 @@ TEST_F(SqratTest, FunctionReturningReferencesToClassesWithStaticMembers) {
     
 }
 
+
+//
+// Overloads are dispatched by argument count through an array shared by all overloads of a name
+//
+
+class Counter {
+public:
+    Counter() : count(0), step(1) {}
+    Counter(int c) : count(c), step(1) {}
+    Counter(int c, int s) : count(c), step(s) {}
+
+    int Add() { return count += step; }
+    int Add(int n) { return count += n * step; }
+    int Add(int n, int m) { return count += n * m * step; }
+
+    int count, step;
+};
+
+class ScaledCounter : public Counter {
+public:
+    ScaledCounter() {}
+    ScaledCounter(int c, int s) : Counter(c, s) {}
+    ScaledCounter(int c, int s, int scale) : Counter(c, s * scale) {}
+};
+
+static int AddTwice(Counter* c, int n) {
+    c->Add(n);
+    return c->Add(n);
+}
+
+TEST_F(SqratTest, OverloadDispatchByArity) {
+    DefaultVM::Set(vm);
+
+    Class<Counter> counter(vm, _SC("Counter"));
+    counter
+    .Ctor()
+    .Ctor<int>()
+    .Ctor<int, int>()
+    .Overload<int (Counter::*)(int, int)>(_SC("Add"), &Counter::Add)
+    .Overload<int (Counter::*)()>(_SC("Add"), &Counter::Add)
+    .Overload<int (Counter::*)(int)>(_SC("Add"), &Counter::Add)
+    .GlobalOverload(_SC("AddTwice"), &AddTwice)
+    .Var(_SC("count"), &Counter::count);
+    RootTable().Bind(_SC("Counter"), counter);
+
+    DerivedClass<ScaledCounter, Counter> scaled(vm, _SC("ScaledCounter"));
+    scaled
+    .Ctor()
+    .Ctor<int, int>()
+    .Ctor<int, int, int>();
+    RootTable().Bind(_SC("ScaledCounter"), scaled);
+
+    Script script;
+    script.CompileString(_SC(" \
+        local c = Counter(); \
+        gTest.EXPECT_INT_EQ(1, c.Add()); \
+        gTest.EXPECT_INT_EQ(4, c.Add(3)); \
+        gTest.EXPECT_INT_EQ(10, c.Add(2, 3)); \
+        gTest.EXPECT_INT_EQ(14, c.AddTwice(2)); \
+        gTest.EXPECT_INT_EQ(5, Counter(5).count); \
+        gTest.EXPECT_INT_EQ(9, Counter(5, 2).Add(2)); \
+        \
+        local failed = false; \
+        try { c.Add(1, 2, 3); } catch (e) { failed = true; gTest.EXPECT_STR_EQ(e, \"wrong number of parameters\"); } \
+        gTest.EXPECT_TRUE(failed); \
+        \
+        local s = ScaledCounter(0, 1, 10); \
+        gTest.EXPECT_INT_EQ(10, s.Add()); \
+        gTest.EXPECT_INT_EQ(3, ScaledCounter(1, 2).Add()); \
+        \
+        failed = false; \
+        try { Counter(0, 1, 10); } catch (e) { failed = true; } \
+        gTest.EXPECT_TRUE(failed); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
+
+//
+// Overloads taking the same number of arguments are chosen by the types of the arguments
+//
+
+class Weight {
+public:
+    Weight() : grams(0) {}
+    Weight(int g) : grams(g) {}
+    virtual ~Weight() {}
+    int grams;
+};
+
+class HeavyWeight : public Weight {
+public:
+    HeavyWeight() : Weight(1000) {}
+};
+
+class Scale {
+public:
+    Scale() : total(0), unit(_SC("g")) {}
+    Scale(int t) : total(t), unit(_SC("g")) {}
+    Scale(const SQChar* u) : total(0), unit(u) {}
+
+    int Add(int) { return 1; }
+    int Add(float) { return 2; }
+    int Add(const Weight& w) { total += w.grams; return 3; }
+    int Add(int, int) { return 4; }
+    int Add(float, const Weight&) { return 5; }
+
+    int total;
+    string unit;
+};
+
+static int Describe(int) { return 1; }
+static int Describe(const SQChar*) { return 2; }
+static int Describe(bool) { return 3; }
+static int Describe(Weight*) { return 4; }
+
+TEST_F(SqratTest, OverloadResolutionByType) {
+    DefaultVM::Set(vm);
+
+    Class<Weight> weight(vm, _SC("Weight"));
+    weight.Ctor<int>();
+    RootTable().Bind(_SC("Weight"), weight);
+    DerivedClass<HeavyWeight, Weight> heavyWeight(vm, _SC("HeavyWeight"));
+    heavyWeight.Ctor();
+    RootTable().Bind(_SC("HeavyWeight"), heavyWeight);
+
+    Class<Scale> scale(vm, _SC("Scale"));
+    scale
+    .Ctor()
+    .Ctor<int>()
+    .Ctor<const SQChar*>()
+    .Overload<int (Scale::*)(int)>(_SC("Add"), &Scale::Add)
+    .Overload<int (Scale::*)(float)>(_SC("Add"), &Scale::Add)
+    .Overload<int (Scale::*)(const Weight&)>(_SC("Add"), &Scale::Add)
+    .Overload<int (Scale::*)(int, int)>(_SC("Add"), &Scale::Add)
+    .Overload<int (Scale::*)(float, const Weight&)>(_SC("Add"), &Scale::Add)
+    .Var(_SC("total"), &Scale::total)
+    .Var(_SC("unit"), &Scale::unit);
+    RootTable().Bind(_SC("Scale"), scale);
+
+    RootTable().Overload<int (*)(int)>(_SC("Describe"), &Describe);
+    RootTable().Overload<int (*)(const SQChar*)>(_SC("Describe"), &Describe);
+    RootTable().Overload<int (*)(bool)>(_SC("Describe"), &Describe);
+    RootTable().Overload<int (*)(Weight*)>(_SC("Describe"), &Describe);
+
+    Script script;
+    script.CompileString(_SC(" \
+        local s = Scale(); \
+        for (local i = 0; i < 3; ++i) { /* the second time round the cached choices are used */ \
+            gTest.EXPECT_INT_EQ(1, s.Add(1)); \
+            gTest.EXPECT_INT_EQ(2, s.Add(1.5)); \
+            gTest.EXPECT_INT_EQ(3, s.Add(Weight(10))); \
+            gTest.EXPECT_INT_EQ(3, s.Add(HeavyWeight())); \
+            gTest.EXPECT_INT_EQ(4, s.Add(1, 2)); \
+            gTest.EXPECT_INT_EQ(5, s.Add(1.5, Weight(1))); \
+            gTest.EXPECT_INT_EQ(5, s.Add(1, Weight(1))); \
+            gTest.EXPECT_INT_EQ(1, Describe(7)); \
+            gTest.EXPECT_INT_EQ(2, Describe(\"seven\")); \
+            gTest.EXPECT_INT_EQ(3, Describe(true)); \
+            gTest.EXPECT_INT_EQ(4, Describe(Weight(7))); \
+            gTest.EXPECT_INT_EQ(4, Describe(null)); \
+        } \
+        gTest.EXPECT_INT_EQ(3030, s.total); \
+        gTest.EXPECT_INT_EQ(5, Scale(5).total); \
+        gTest.EXPECT_STR_EQ(\"kg\", Scale(\"kg\").unit); \
+        \
+        local failed = false; \
+        try { s.Add({}); } catch (e) { failed = true; gTest.EXPECT_STR_EQ(e, \"wrong type of parameters\"); } \
+        gTest.EXPECT_TRUE(failed); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
+
+static int Weigh(Weight*) { return 1; }
+static int Weigh(HeavyWeight*) { return 2; }
+
+TEST_F(SqratTest, OverloadResolutionOfScriptSubclass) {
+    DefaultVM::Set(vm);
+
+    Class<Weight> weight(vm, _SC("Weight"));
+    weight.Ctor<int>();
+    RootTable().Bind(_SC("Weight"), weight);
+    DerivedClass<HeavyWeight, Weight> heavyWeight(vm, _SC("HeavyWeight"));
+    heavyWeight.Ctor();
+    RootTable().Bind(_SC("HeavyWeight"), heavyWeight);
+
+    RootTable().Overload<int (*)(Weight*)>(_SC("Weigh"), &Weigh);
+    RootTable().Overload<int (*)(HeavyWeight*)>(_SC("Weigh"), &Weigh);
+
+    // an instance of a Squirrel class has no type tag of its own, its nearest native base must decide every call alike
+    Script script;
+    script.CompileString(_SC(" \
+        class Anvil extends HeavyWeight { \
+            constructor() { base.constructor(); } \
+        } \
+        local a = Anvil(); \
+        gTest.EXPECT_INT_EQ(2, Weigh(a)); \
+        gTest.EXPECT_INT_EQ(2, Weigh(a)); \
+        gTest.EXPECT_INT_EQ(1, Weigh(Weight(1))); \
+        gTest.EXPECT_INT_EQ(2, Weigh(Anvil())); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
@@ -349,3 +349,156 @@ TEST_F(SqratTest, MemberFunction) {
     }
 }
 
+
+#if defined(SCRAT_USE_CXX11_OPTIMIZATIONS)
+
+// the variadic binding engine has no limit on the number of arguments
+
+int f16(int a1, int a2, int a3, int a4, int a5, int a6, int a7, int a8,
+        int a9, int a10, int a11, int a12, int a13, int a14, int a15, int a16)
+{
+    return (a1 == 1)&& (a2 == 2) && (a3 == 3) && (a4 == 4) && (a5 == 5)
+           && (a6 == 6) && (a7 == 7) && (a8 == 8)&& (a9 == 9) && (a10 == 10)
+           && (a11 == 11) && (a12 == 12) && (a13 == 13) && (a14 == 14)
+           && (a15 == 15) && (a16 == 16);
+}
+
+class C16 {
+public:
+    int f16(int a1, int a2, int a3, int a4, int a5, int a6, int a7, int a8,
+            int a9, int a10, int a11, int a12, int a13, int a14, int a15, int a16) const
+    {
+        return ::f16(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16);
+    }
+};
+
+TEST_F(SqratTest, VariadicFunctionParams) {
+    DefaultVM::Set(vm);
+
+    RootTable().Func(_SC("f16"), &f16);
+
+    Class<C16> CC(vm, _SC("C16"));
+    CC.Func(_SC("f16"), &C16::f16);
+    RootTable().Bind(_SC("C16"), CC);
+
+    Script script;
+    script.CompileString(_SC(" \
+        c <- C16(); \
+        gTest.EXPECT_INT_EQ(1, f16(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)); \
+        gTest.EXPECT_INT_EQ(1, c.f16(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)); \
+        function sum16(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16) { \
+            return a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12 + a13 + a14 + a15 + a16; \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    Function sum16 = RootTable().GetFunction(_SC("sum16"));
+    SharedPtr<int> total = sum16.Evaluate<int>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    ASSERT_TRUE(total.Get() != NULL);
+    EXPECT_EQ(136, *total);
+}
+
+#endif
+
+class UncheckedPoint {
+public:
+    UncheckedPoint() : x(0), y(0) {}
+    void Set(int x_, float y_) { x = x_; y = y_; }
+    int Sum() const { return x + static_cast<int>(y); }
+    UncheckedPoint& Self() { return *this; }
+    static int Twice(int a) { return a * 2; }
+    int x;
+    float y;
+};
+
+static int UncheckedScale(UncheckedPoint* p, int factor) {
+    return p->x * factor;
+}
+
+static double UncheckedMix(int a, double b, bool c, const SQChar* name) {
+    return (c && name[0] == 'm') ? a + b : 0.0;
+}
+
+TEST_F(SqratTest, UncheckedFunction) {
+    DefaultVM::Set(vm);
+
+    Class<UncheckedPoint> point(vm, _SC("UncheckedPoint"));
+    point.FuncUnchecked(_SC("Set"), &UncheckedPoint::Set)
+        .FuncUnchecked(_SC("Sum"), &UncheckedPoint::Sum)
+        .FuncUnchecked(_SC("Self"), &UncheckedPoint::Self)
+        .GlobalFuncUnchecked(_SC("Scale"), &UncheckedScale)
+        .StaticFuncUnchecked(_SC("Twice"), &UncheckedPoint::Twice)
+        .Var(_SC("x"), &UncheckedPoint::x);
+    RootTable().Bind(_SC("UncheckedPoint"), point);
+    RootTable().FuncUnchecked(_SC("UncheckedMix"), &UncheckedMix);
+
+    Script script;
+    script.CompileString(_SC(" \
+        local p = UncheckedPoint(); \
+        p.Set(3, 4.5); \
+        gTest.EXPECT_INT_EQ(7, p.Sum()); \
+        p.Set(2.0, 1); /* numbers still convert */ \
+        gTest.EXPECT_INT_EQ(3, p.Sum()); \
+        gTest.EXPECT_INT_EQ(2, p.Self().x); \
+        gTest.EXPECT_INT_EQ(10, p.Scale(5)); \
+        gTest.EXPECT_INT_EQ(8, UncheckedPoint.Twice(4)); \
+        gTest.EXPECT_FLOAT_EQ(3.5, UncheckedMix(1, 2.5, true, \"mix\")); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
+
+static int UncheckedIsNull(UncheckedPoint* p) {
+    return (p == NULL) ? 1 : 0;
+}
+
+#if !defined(SCRAT_NO_ERROR_CHECKING)
+TEST_F(SqratTest, UncheckedFunctionTypeError) {
+    DefaultVM::Set(vm);
+
+    Class<UncheckedPoint> point(vm, _SC("UncheckedPoint"));
+    point.Func(_SC("Sum"), &UncheckedPoint::Sum)
+        .FuncUnchecked(_SC("UncheckedSum"), &UncheckedPoint::Sum);
+    RootTable().Bind(_SC("UncheckedPoint"), point);
+    RootTable().FuncUnchecked(_SC("UncheckedIsNull"), &UncheckedIsNull);
+#if defined(SCRAT_USE_EXCEPTIONS)
+    RootTable().SetValue(_SC("expected"), 2); // the error is raised in the script
+#else
+    RootTable().SetValue(_SC("expected"), 1); // the error is discarded and the function gets NULL
+#endif
+
+    // a mismatched argument must neither unwind through the VM nor be left pending for the next checked call
+    Script script;
+    script.CompileString(_SC(" \
+        local result = 0; \
+        try { result = UncheckedIsNull(\"not a point\"); } catch (e) { result = 2; } \
+        gTest.EXPECT_INT_EQ(expected, result); \
+        gTest.EXPECT_INT_EQ(0, UncheckedPoint().Sum()); \
+        local wrongThis = false; \
+        try { UncheckedPoint.UncheckedSum.call({}); } catch (e) { wrongThis = true; } \
+        gTest.EXPECT_TRUE(wrongThis); \
+        gTest.EXPECT_INT_EQ(0, UncheckedPoint().Sum()); \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+}
+#endif
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+using namespace Sqrat;
+
+class InlineColor {
+public:
+    InlineColor() : r(0), g(0), b(0), a(1.0) { ++live; }
+    InlineColor(int r_, int g_, int b_) : r(r_), g(g_), b(b_), a(1.0) { ++live; }
+    InlineColor(const InlineColor& o) : r(o.r), g(o.g), b(o.b), a(o.a) { ++live; }
+    ~InlineColor() { --live; }
+
+    int Sum() const { return r + g + b; }
+
+    int r, g, b;
+    double a; // stricter alignment than the bookkeeping pointers on some platforms
+
+    static int live;
+};
+
+int InlineColor::live = 0;
+
+class InlineTinted : public InlineColor {
+public:
+    InlineTinted() : tint(7) {}
+    int tint;
+};
+
+static InlineColor MakeGray(int v) {
+    return InlineColor(v, v, v);
+}
+
+TEST_F(SqratTest, InlineAllocatorInstances) {
+    DefaultVM::Set(vm);
+
+    Class<InlineColor, InlineAllocator<InlineColor> > color(vm, _SC("InlineColor"));
+    color.Ctor()
+        .Ctor<int, int, int>()
+        .Func(_SC("Sum"), &InlineColor::Sum)
+        .Var(_SC("r"), &InlineColor::r)
+        .Var(_SC("g"), &InlineColor::g)
+        .Var(_SC("b"), &InlineColor::b)
+        .Var(_SC("a"), &InlineColor::a);
+    RootTable().Bind(_SC("InlineColor"), color);
+
+    DerivedClass<InlineTinted, InlineColor, InlineAllocator<InlineTinted> > tinted(vm, _SC("InlineTinted"));
+    tinted.Var(_SC("tint"), &InlineTinted::tint);
+    RootTable().Bind(_SC("InlineTinted"), tinted);
+
+    RootTable().Func(_SC("MakeGray"), &MakeGray);
+
+    Script script;
+    string err;
+    if (!script.CompileString(_SC(" \
+        local c = InlineColor(1, 2, 3); \
+        gTest.EXPECT_INT_EQ(c.Sum(), 6); \
+        c.g = 10; \
+        gTest.EXPECT_INT_EQ(c.Sum(), 14); \
+        gTest.EXPECT_FLOAT_EQ(c.a, 1.0); \
+        \
+        local d = clone c; \
+        d.r = 100; \
+        gTest.EXPECT_INT_EQ(c.r, 1); \
+        gTest.EXPECT_INT_EQ(d.Sum(), 113); \
+        \
+        gTest.EXPECT_INT_EQ(MakeGray(4).Sum(), 12); \
+        \
+        local t = InlineTinted(); \
+        t.r = 5; \
+        gTest.EXPECT_INT_EQ(t.tint, 7); \
+        gTest.EXPECT_INT_EQ(t.Sum(), 5); \
+        \
+        class ScriptColor extends InlineColor { \
+            constructor() { base.constructor(2, 2, 2); } \
+            function Twice() { return Sum() * 2; } \
+        } \
+        gTest.EXPECT_INT_EQ(ScriptColor().Twice(), 12); \
+        \
+        for (local i = 0; i < 1000; ++i) { \
+            local tmp = InlineColor(i, i, i); \
+            gTest.EXPECT_INT_EQ(tmp.Sum(), i * 3); \
+        } \
+        "), err)) {
+        FAIL() << _SC("Compile Failed: ") << err;
+    }
+    if (!script.Run(err)) {
+        FAIL() << _SC("Run Failed: ") << err;
+    }
+    script.Release();
+    sq_collectgarbage(vm);
+
+    // every object constructed inside an instance must have been destroyed with it
+    EXPECT_EQ(0, InlineColor::live);
+    EXPECT_EQ(0u, ClassType<InlineColor>::getClassData(vm)->instances->Size());
+}
+
+TEST_F(SqratTest, InlineAllocatorInstanceTracking) {
+    DefaultVM::Set(vm);
+
+    Class<InlineColor, InlineAllocator<InlineColor> > color(vm, _SC("InlineColor"));
+    color.Var(_SC("r"), &InlineColor::r);
+    RootTable().Bind(_SC("InlineColor"), color);
+
+    InlineColor native(3, 4, 5);
+    PushVar(vm, native); // copied into the memory of the new instance
+    InlineColor* copy = Var<InlineColor*>(vm, -1).value;
+    EXPECT_NE(&native, copy);
+    EXPECT_EQ(3, copy->r);
+    EXPECT_EQ(1u, ClassType<InlineColor>::getClassData(vm)->instances->Size());
+
+    // pushing the pointer of an object owned by an instance must push that same instance
+    PushVar(vm, copy);
+    EXPECT_EQ(0, sq_cmp(vm));
+    sq_pop(vm, 2);
+
+    sq_collectgarbage(vm);
+    EXPECT_EQ(1, InlineColor::live); // only native is left
+}
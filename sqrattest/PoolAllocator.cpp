@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+using namespace Sqrat;
+
+class PooledRect {
+public:
+    PooledRect() : x(0), y(0), w(0), h(0) { ++live; }
+    PooledRect(int x_, int y_, int w_, int h_) : x(x_), y(y_), w(w_), h(h_) { ++live; }
+    PooledRect(const PooledRect& o) : x(o.x), y(o.y), w(o.w), h(o.h) { ++live; }
+    ~PooledRect() { --live; }
+
+    int Area() const { return w * h; }
+
+    int x, y, w, h;
+
+    static int live;
+};
+
+int PooledRect::live = 0;
+
+static void BindPooledRect(HSQUIRRELVM v) {
+    Class<PooledRect, PoolAllocator<PooledRect> > rect(v, _SC("PooledRect"));
+    rect.Ctor()
+        .Ctor<int, int, int, int>()
+        .Func(_SC("Area"), &PooledRect::Area)
+        .Var(_SC("w"), &PooledRect::w)
+        .Var(_SC("h"), &PooledRect::h);
+    RootTable(v).Bind(_SC("PooledRect"), rect);
+}
+
+static bool RunPoolScript(HSQUIRRELVM v, const SQChar* code) {
+    Script script(v);
+    string err;
+    if (!script.CompileString(code, err)) {
+        ADD_FAILURE() << _SC("Compile Failed: ") << err;
+        return false;
+    }
+    if (!script.Run(err)) {
+        ADD_FAILURE() << _SC("Run Failed: ") << err;
+        return false;
+    }
+    return true;
+}
+
+TEST_F(SqratTest, PoolAllocatorReusesBlocks) {
+    DefaultVM::Set(vm);
+    BindPooledRect(vm);
+
+    EXPECT_TRUE(RunPoolScript(vm, _SC(" \
+        for (local i = 0; i < 1000; ++i) { \
+            local r = PooledRect(0, 0, i, 2); \
+            gTest.EXPECT_INT_EQ(r.Area(), i * 2); \
+            local c = clone r; \
+            c.w = 1; \
+            gTest.EXPECT_INT_EQ(c.Area(), 2); \
+            gTest.EXPECT_INT_EQ(r.Area(), i * 2); \
+        } \
+        ")));
+
+    PoolStats stats = PoolAllocator<PooledRect>::GetStats(vm);
+    EXPECT_EQ(0u, stats.live);
+    EXPECT_EQ(0, PooledRect::live);
+    // only a handful of instances were ever alive at once so only a handful of blocks were needed
+    EXPECT_GE(stats.peak, 2u);
+    EXPECT_LE(stats.peak, 4u);
+    EXPECT_EQ(stats.peak, stats.pooled);
+    EXPECT_EQ(0u, ClassType<PooledRect>::getClassData(vm)->instances->Size());
+}
+
+TEST_F(SqratTest, PoolAllocatorHighWaterMark) {
+    DefaultVM::Set(vm);
+    BindPooledRect(vm);
+    PoolAllocator<PooledRect>::SetHighWaterMark(vm, 4);
+
+    EXPECT_TRUE(RunPoolScript(vm, _SC(" \
+        rects <- []; \
+        for (local i = 0; i < 10; ++i) rects.append(PooledRect()); \
+        ")));
+
+    PoolStats stats = PoolAllocator<PooledRect>::GetStats(vm);
+    EXPECT_EQ(10u, stats.live);
+    EXPECT_EQ(0u, stats.pooled);
+    EXPECT_EQ(10u, stats.peak);
+
+    EXPECT_TRUE(RunPoolScript(vm, _SC("rects.clear();")));
+
+    stats = PoolAllocator<PooledRect>::GetStats(vm);
+    EXPECT_EQ(0u, stats.live);
+    EXPECT_EQ(4u, stats.pooled); // the six blocks above the mark went back to the heap
+    EXPECT_EQ(10u, stats.peak);
+
+    PoolAllocator<PooledRect>::SetHighWaterMark(vm, 1);
+    EXPECT_EQ(1u, PoolAllocator<PooledRect>::GetStats(vm).pooled);
+}
+
+TEST_F(SqratTest, PoolAllocatorOutlivesVM) {
+    HSQUIRRELVM other = sq_open(1024);
+    BindPooledRect(other);
+
+    EXPECT_TRUE(RunPoolScript(other, _SC(" \
+        keep <- [PooledRect(1, 2, 3, 4), PooledRect()]; \
+        ")));
+    EXPECT_EQ(2u, PoolAllocator<PooledRect>::GetStats(other).live);
+
+    // instances released while the VM closes must still find the pool of their blocks
+    sq_close(other);
+    EXPECT_EQ(0, PooledRect::live);
+
+    // every VM has its own pool
+    BindPooledRect(vm);
+    EXPECT_EQ(0u, PoolAllocator<PooledRect>::GetStats(vm).peak);
+}
+
+class PooledThrowingCopy {
+public:
+    PooledThrowingCopy() {}
+    PooledThrowingCopy(const PooledThrowingCopy&) { throw 1; }
+};
+
+TEST_F(SqratTest, PoolAllocatorConstructorThrows) {
+    Class<PooledThrowingCopy, PoolAllocator<PooledThrowingCopy> > cls(vm, _SC("PooledThrowingCopy"));
+    RootTable(vm).Bind(_SC("PooledThrowingCopy"), cls);
+
+    // the block taken for the copy goes back to the pool when the copy constructor throws
+    SQInteger top = sq_gettop(vm);
+    PooledThrowingCopy value;
+    bool thrown = false;
+    try {
+        PushVar(vm, value);
+    } catch (int) {
+        thrown = true;
+    }
+    sq_settop(vm, top);
+    EXPECT_TRUE(thrown);
+
+    PoolStats stats = PoolAllocator<PooledThrowingCopy>::GetStats(vm);
+    EXPECT_EQ(0u, stats.live);
+    EXPECT_EQ(1u, stats.pooled);
+}
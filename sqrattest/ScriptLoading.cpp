@@ -66,4 +66,68 @@ TEST_F(SqratTest, LoadScriptFromFile) {
     if (Sqrat::Error::Occurred(vm)) {
         FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
     }
-}
\ No newline at end of file
+}
+static void WriteScriptFile(const char* path, const char* code) {
+    FILE* file = fopen(path, "w");
+    ASSERT_TRUE(file != NULL);
+    fputs(code, file);
+    fclose(file);
+}
+
+static bool CompileAndRun(HSQUIRRELVM vm, const SQChar* path) {
+    Script script(vm);
+    string err;
+    if (!script.CompileFile(path, err)) {
+        ADD_FAILURE() << _SC("Script Compile Failed: ") << err;
+        return false;
+    }
+    if (!script.Run(err)) {
+        ADD_FAILURE() << _SC("Script Run Failed: ") << err;
+        return false;
+    }
+    return true;
+}
+
+TEST_F(SqratTest, LoadScriptFromBytecodeCache) {
+    //
+    // Compile a file once, then load it from its cache file until it changes
+    //
+
+    WriteScriptFile("cache_test.nut", "cached <- 1;");
+    BytecodeCache::Enable();
+    EXPECT_EQ(string(_SC("cache_test.nut.cache")), BytecodeCache::GetCachePath(_SC("cache_test.nut")));
+
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    FILE* cache = fopen("cache_test.nut.cache", "rb");
+    EXPECT_TRUE(cache != NULL);
+    if (cache != NULL) {
+        fclose(cache);
+    }
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    EXPECT_EQ(1, *RootTable(vm).GetValue<int>(_SC("cached")));
+
+    // same size and most likely the same modification time: only the content hash tells them apart
+    WriteScriptFile("cache_test.nut", "cached <- 2;");
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    EXPECT_EQ(2, *RootTable(vm).GetValue<int>(_SC("cached")));
+
+    // an unreadable cache file is replaced
+    WriteScriptFile("cache_test.nut.cache", "garbage");
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    EXPECT_EQ(2, *RootTable(vm).GetValue<int>(_SC("cached")));
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    EXPECT_EQ(2, *RootTable(vm).GetValue<int>(_SC("cached")));
+
+    // cache files can be kept in a directory instead
+    BytecodeCache::Enable(_SC("scripts"));
+    string cachePath = BytecodeCache::GetCachePath(_SC("cache_test.nut"));
+    EXPECT_EQ(string(_SC("scripts/")), cachePath.substr(0, 8));
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+    EXPECT_TRUE(CompileAndRun(vm, _SC("cache_test.nut")));
+
+    BytecodeCache::Disable();
+    EXPECT_FALSE(BytecodeCache::IsEnabled());
+    remove(std::string(cachePath.begin(), cachePath.end()).c_str());
+    remove("cache_test.nut.cache");
+    remove("cache_test.nut");
+}
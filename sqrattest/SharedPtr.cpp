@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <new>
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include "Fixture.h"
+
+using namespace Sqrat;
+
+// Every test file is its own executable (see build_tests.sh), so counting allocations here only affects this one
+static unsigned int allocations = 0;
+static unsigned int deallocations = 0;
+
+void* operator new(size_t size) {
+    ++allocations;
+    void* p = malloc(size ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) throw() {
+    if (p != NULL) {
+        ++deallocations;
+    }
+    free(p);
+}
+
+class SharedCounted {
+public:
+    SharedCounted() : x(0) { ++live; }
+    SharedCounted(int x_) : x(x_) { ++live; }
+    virtual ~SharedCounted() { --live; }
+    int x;
+    static int live;
+};
+
+int SharedCounted::live = 0;
+
+class SharedCountedDerived : public SharedCounted {
+public:
+    SharedCountedDerived(int x_, double y_) : SharedCounted(x_), y(y_) {}
+    double y;
+};
+
+TEST_F(SqratTest, SharedPtrAllocations) {
+    // only compare counts (gtest and the standard library may allocate too): adopting an object allocated with new
+    // costs an allocation for the shared counts, MakeShared allocates the object and the counts together
+    unsigned int before = allocations;
+    {
+        SharedPtr<SharedCounted> p(new SharedCounted(1));
+    }
+    unsigned int adoptAllocations = allocations - before;
+    EXPECT_EQ(0, SharedCounted::live);
+
+    before = allocations;
+    {
+        SharedPtr<SharedCounted> p = MakeShared<SharedCounted>(2);
+        SharedPtr<SharedCounted> copy = p;
+        WeakPtr<SharedCounted> weak = p;
+        EXPECT_EQ(2, weak.Lock()->x);
+    }
+    unsigned int makeAllocations = allocations - before;
+    EXPECT_EQ(0, SharedCounted::live);
+    EXPECT_LT(makeAllocations, adoptAllocations);
+
+    // results of Function::Evaluate take fewer allocations than adopting a new value
+    DefaultVM::Set(vm);
+    Script script;
+    script.CompileString(_SC("function Three() { return 3; }"));
+    script.Run();
+    Function three = RootTable().GetFunction(_SC("Three"));
+    before = allocations;
+    {
+        SharedPtr<int> adopted(new int(3));
+    }
+    unsigned int adoptIntAllocations = allocations - before;
+    before = allocations;
+    SharedPtr<int> result = three.Evaluate<int>();
+    unsigned int evaluateAllocations = allocations - before;
+    EXPECT_LT(evaluateAllocations, adoptIntAllocations);
+    EXPECT_EQ(3, *result);
+}
+
+class SharedThrowing {
+public:
+    SharedThrowing(int x) { if (x < 0) throw x; }
+};
+
+TEST_F(SqratTest, SharedPtrMakeSharedThrowingConstructor) {
+    // the block allocated by MakeShared is freed if the constructor throws
+    unsigned int outstanding = allocations - deallocations;
+    bool thrown = false;
+    try {
+        MakeShared<SharedThrowing>(-1);
+    } catch (int) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(outstanding, allocations - deallocations);
+}
+
+TEST_F(SqratTest, SharedPtrWeakOutlivesObject) {
+    WeakPtr<SharedCounted> weak;
+    {
+        SharedPtr<SharedCounted> base = MakeShared<SharedCountedDerived>(5, 1.5);
+        weak = base;
+        EXPECT_FALSE(weak.Expired());
+        EXPECT_EQ(1, SharedCounted::live);
+    }
+    // the object is destroyed with its last SharedPtr even though the block lives on for the WeakPtr
+    EXPECT_EQ(0, SharedCounted::live);
+    EXPECT_TRUE(weak.Expired());
+    EXPECT_TRUE(weak.Lock().Get() == NULL);
+}
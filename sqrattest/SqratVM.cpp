@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 #include <sqrat.h>
 #include <sqrat/sqratVM.h>
+#include <sqrat/sqratVMPool.h>
 #include "Fixture.h"
 /* test demonstrating Sourceforge bug 3507590 */
    
@@ -54,4 +55,76 @@ TEST_F(SqratTest, SqratVM)
     bind(vm1.GetVM());
     bind(vm2.GetVM());
     
-}
\ No newline at end of file
+}
+TEST_F(SqratTest, SqratVMRegistry)
+{
+    SqratVM vm1;
+    SqratVM* vm2 = new SqratVM;
+
+    EXPECT_EQ(&vm1, SqratVM::Get(vm1.GetVM()));
+    EXPECT_EQ(vm2, SqratVM::Get(vm2->GetVM()));
+    EXPECT_TRUE(SqratVM::Get(vm) == NULL); // not created by a SqratVM
+
+    std::vector<SqratVM*> all = SqratVM::GetAll();
+    EXPECT_EQ(2u, all.size());
+
+    // the error handlers find the SqratVM of the VM they run in
+    EXPECT_EQ(SqratVM::SQRAT_RUNTIME_ERROR, vm2->DoString(_SC("throw \"failed\";")));
+    EXPECT_EQ(Sqrat::string(_SC("failed")), vm2->GetLastErrorMsg());
+    EXPECT_EQ(SqratVM::SQRAT_COMPILE_ERROR, vm1.DoString(_SC("local x = ;")));
+    EXPECT_FALSE(vm1.GetLastErrorMsg().empty());
+
+    delete vm2;
+    all = SqratVM::GetAll();
+    ASSERT_EQ(1u, all.size());
+    EXPECT_EQ(&vm1, all[0]);
+}
+
+static void InitPooledVM(SqratVM& vm)
+{
+    bind(vm.GetVM());
+    vm.DoString(_SC("baseline <- 1;"));
+}
+
+TEST_F(SqratTest, SqratVMPoolReset)
+{
+    SqratVMPool pool(2, &InitPooledVM);
+    VMPoolStats stats = pool.GetStats();
+    EXPECT_EQ(2u, stats.created);
+    EXPECT_EQ(2u, stats.idle);
+
+    SqratVM* first = pool.Acquire();
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, first->DoString(_SC(" \
+        added <- 2; \
+        baseline = 3; \
+        simpleclass = null; \
+        ")));
+    pool.Release(first);
+
+    // the next checkout gets the same VM back with its root table as it was after initialization
+    SqratVM* second = pool.Acquire();
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, second->DoString(_SC(" \
+        if (\"added\" in getroottable()) throw \"added slot was kept\"; \
+        if (baseline != 1) throw \"baseline value was not restored\"; \
+        simpleclass().memfun(); \
+        ")));
+    EXPECT_EQ(Sqrat::string(), second->GetLastErrorMsg());
+
+    // more checkouts than pooled VMs create new ones
+    SqratVM* third = pool.Acquire();
+    SqratVM* fourth = pool.Acquire();
+    stats = pool.GetStats();
+    EXPECT_EQ(3u, stats.created);
+    EXPECT_EQ(4u, stats.checkouts);
+    EXPECT_EQ(1u, stats.reuses);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(3u, stats.inUse);
+    EXPECT_EQ(0u, stats.idle);
+    EXPECT_EQ(1u, stats.resets);
+
+    pool.Release(second);
+    pool.Release(third);
+    pool.Release(fourth);
+    EXPECT_EQ(3u, pool.GetStats().idle);
+}
@@ -103,4 +103,230 @@ TEST_F(SqratTest, FunctionAsArgument) {
     if (Sqrat::Error::Occurred(vm)) {
         FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
     }
-}
\ No newline at end of file
+}
+TEST_F(SqratTest, TryEvaluateFunction) {
+    DefaultVM::Set(vm);
+
+    Script script;
+    script.CompileString(_SC(" \
+        function AddTwo(a, b) { \
+            return a + b; \
+        } \
+        function Half(a) { \
+            return a / 2.0; \
+        } \
+        function IsPositive(a) { \
+            return a > 0; \
+        } \
+        function Greet(name) { \
+            return \"hello \" + name; \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    SQInteger top = sq_gettop(vm);
+
+    Function addTwo = RootTable().GetFunction(_SC("AddTwo"));
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(addTwo.TryEvaluate(sum, i, 2));
+        EXPECT_EQ(i + 2, sum);
+    }
+
+    float half = 0;
+    EXPECT_TRUE(RootTable().GetFunction(_SC("Half")).TryEvaluate(half, 5));
+    EXPECT_FLOAT_EQ(2.5f, half);
+
+    bool positive = false;
+    EXPECT_TRUE(RootTable().GetFunction(_SC("IsPositive")).TryEvaluate(positive, 3));
+    EXPECT_TRUE(positive);
+
+    string greeting;
+    EXPECT_TRUE(RootTable().GetFunction(_SC("Greet")).TryEvaluate(greeting, _SC("world")));
+    EXPECT_EQ(string(_SC("hello world")), greeting);
+
+    EXPECT_EQ(top, sq_gettop(vm));
+
+#if !defined (SCRAT_NO_ERROR_CHECKING) && !defined (SCRAT_USE_EXCEPTIONS)
+    // failures leave the output untouched and the error pending like Evaluate does
+    sum = 42;
+    EXPECT_FALSE(addTwo.TryEvaluate(sum, 1));
+    EXPECT_EQ(42, sum);
+    EXPECT_TRUE(Sqrat::Error::Occurred(vm));
+    Sqrat::Error::Clear(vm);
+
+    EXPECT_FALSE(addTwo.TryEvaluate(sum, _SC("a"), _SC("b")));
+    EXPECT_EQ(42, sum);
+    EXPECT_TRUE(Sqrat::Error::Occurred(vm));
+    Sqrat::Error::Clear(vm);
+
+    EXPECT_EQ(top, sq_gettop(vm));
+#endif
+}
+
+TEST_F(SqratTest, PreparedFunctionCalls) {
+    DefaultVM::Set(vm);
+
+    Script script;
+    script.CompileString(_SC(" \
+        calls <- 0; \
+        function AddTwo(a, b) { \
+            return a + b; \
+        } \
+        function Tick() { \
+            ::calls++; \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    SQInteger top = sq_gettop(vm);
+
+    PreparedFunction addTwo(RootTable().GetFunction(_SC("AddTwo")));
+    ASSERT_FALSE(addTwo.IsNull());
+    EXPECT_EQ(3, addTwo.GetParamCount());
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(addTwo.TryEvaluate(sum, i, 2));
+        EXPECT_EQ(i + 2, sum);
+    }
+
+    PreparedFunction tick(RootTable().GetFunction(_SC("Tick")));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(tick.Execute());
+    }
+    EXPECT_EQ(10, RootTable().GetSlot(_SC("calls")).Cast<int>());
+
+    EXPECT_EQ(top, sq_gettop(vm));
+
+#if !defined (SCRAT_NO_ERROR_CHECKING) && !defined (SCRAT_USE_EXCEPTIONS)
+    sum = 42;
+    EXPECT_FALSE(addTwo.TryEvaluate(sum, 1));
+    EXPECT_EQ(42, sum);
+    EXPECT_TRUE(Sqrat::Error::Occurred(vm));
+    Sqrat::Error::Clear(vm);
+
+    EXPECT_FALSE(addTwo.TryEvaluate(sum, _SC("a"), _SC("b")));
+    EXPECT_EQ(42, sum);
+    EXPECT_TRUE(Sqrat::Error::Occurred(vm));
+    Sqrat::Error::Clear(vm);
+
+    EXPECT_FALSE(tick.Execute(1));
+    EXPECT_TRUE(Sqrat::Error::Occurred(vm));
+    Sqrat::Error::Clear(vm);
+
+    EXPECT_EQ(top, sq_gettop(vm));
+#endif
+}
+
+static PreparedFunction* reentrantFact = NULL;
+
+static int NativeFact(int n) {
+    int result = 0;
+    reentrantFact->TryEvaluate(result, n);
+    return result;
+}
+
+TEST_F(SqratTest, PreparedFunctionReentrantCalls) {
+    DefaultVM::Set(vm);
+
+    RootTable().Func(_SC("NativeFact"), &NativeFact);
+
+    Script script;
+    script.CompileString(_SC(" \
+        function Fact(n) { \
+            return n <= 1 ? 1 : n * NativeFact(n - 1); \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    SQInteger top = sq_gettop(vm);
+
+    // the script calls back into the same PreparedFunction while it runs
+    PreparedFunction fact(RootTable().GetFunction(_SC("Fact")));
+    reentrantFact = &fact;
+    int result = 0;
+    EXPECT_TRUE(fact.TryEvaluate(result, 5));
+    EXPECT_EQ(120, result);
+    EXPECT_TRUE(fact.TryEvaluate(result, 6));
+    EXPECT_EQ(720, result);
+    reentrantFact = NULL;
+
+    EXPECT_EQ(top, sq_gettop(vm));
+}
+
+TEST_F(SqratTest, BatchFunctionCalls) {
+    DefaultVM::Set(vm);
+
+    Script script;
+    script.CompileString(_SC(" \
+        total <- 0; \
+        function Accumulate(x) { \
+            if (x == 3) throw \"three\"; \
+            ::total += x; \
+        } \
+        function Square(x) { \
+            if (x == 3) return \"three\"; \
+            return x * x; \
+        } \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Script Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    SQInteger top = sq_gettop(vm);
+    int values[] = {1, 2, 3, 4, 5};
+
+    std::vector<BatchError> errors;
+    Function accumulate = RootTable().GetFunction(_SC("Accumulate"));
+    EXPECT_EQ(4u, accumulate.ExecuteBatch(values, values + 5, &errors));
+    EXPECT_EQ(12, RootTable().GetSlot(_SC("total")).Cast<int>());
+    ASSERT_EQ(1u, errors.size());
+    EXPECT_EQ(2u, errors[0].index);
+    EXPECT_FALSE(errors[0].message.empty());
+
+    errors.clear();
+    int squares[] = {0, 0, -1, 0, 0};
+    Function square = RootTable().GetFunction(_SC("Square"));
+    EXPECT_EQ(4u, square.EvaluateBatch<int>(values, values + 5, squares, &errors));
+    EXPECT_EQ(1, squares[0]);
+    EXPECT_EQ(4, squares[1]);
+    EXPECT_EQ(-1, squares[2]); // failed elements are left untouched
+    EXPECT_EQ(16, squares[3]);
+    EXPECT_EQ(25, squares[4]);
+    ASSERT_EQ(1u, errors.size());
+    EXPECT_EQ(2u, errors[0].index);
+#if !defined (SCRAT_NO_ERROR_CHECKING) && !defined (SCRAT_USE_EXCEPTIONS)
+    EXPECT_FALSE(Sqrat::Error::Occurred(vm));
+#endif
+
+    // a batch without an error list still runs every element
+    EXPECT_EQ(4u, square.EvaluateBatch<int>(values, values + 5, squares));
+
+    EXPECT_EQ(top, sq_gettop(vm));
+}
@@ -206,6 +206,55 @@ TEST_F(SqratTest, TableGet)
 
 }
 
+TEST_F(SqratTest, TableGetWithKeys)
+{
+    DefaultVM::Set(vm);
+
+    Script script;
+    script.CompileString(_SC(" \
+        tk <- { \
+            name = \"value\", \
+            function update(x) { return x * 2; } \
+        }; \
+        "));
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Compile Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    script.Run();
+    if (Sqrat::Error::Occurred(vm)) {
+        FAIL() << _SC("Run Failed: ") << Sqrat::Error::Message(vm);
+    }
+
+    Table table = RootTable(vm).GetSlot(_SC("tk"));
+    Key name(_SC("name"));
+    Key update(_SC("update"));
+    Key missing(_SC("missing"));
+    EXPECT_EQ(string(_SC("update")), string(update.GetName()));
+
+    // the same Key can be reused for every lookup
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(table.HasKey(name));
+        EXPECT_FALSE(table.HasKey(missing));
+        EXPECT_EQ(string(_SC("value")), table.GetSlot(name).Cast<string>());
+
+        SharedPtr<string> value = table.GetValue<string>(name);
+        EXPECT_TRUE(value != NULL);
+        EXPECT_EQ(string(_SC("value")), *value);
+
+        Function func = table.GetFunction(update);
+        EXPECT_FALSE(func.IsNull());
+        EXPECT_EQ(2 * i, *func.Evaluate<int>(i));
+    }
+
+    EXPECT_TRUE(table.GetFunction(name).IsNull());
+    EXPECT_TRUE(table.GetSlot(missing).IsNull());
+
+    Key copy = name;
+    copy = update;
+    EXPECT_FALSE(table.GetFunction(copy).IsNull());
+}
+
 TEST_F(SqratTest, TableCleanup)    // test case for Sourceforge Sqrat Bug 43
 {
     static const SQChar *sq_code = _SC("\
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <sqrat.h>
+#include <sqrat/sqratZygote.h>
+#include "Fixture.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <sys/wait.h>
+
+#if !defined(_WIN32) // SqratZygote needs fork()
+
+using namespace Sqrat;
+
+class ZygoteCounter
+{
+public:
+    ZygoteCounter() : count(0) {}
+    int Add(int n) { return count += n; }
+    int count;
+};
+
+static void InitZygote(SqratVM& vm)
+{
+    Class<ZygoteCounter> cls(vm.GetVM(), _SC("ZygoteCounter"));
+    cls.Func(_SC("Add"), &ZygoteCounter::Add);
+    RootTable(vm.GetVM()).Bind(_SC("ZygoteCounter"), cls);
+}
+
+TEST_F(SqratTest, ZygoteRunsScriptsInChildren)
+{
+    const char* bootstrap = "zygote_bootstrap.nut";
+    FILE* file = fopen(bootstrap, "w");
+    ASSERT_TRUE(file != NULL);
+    fputs("shared <- ZygoteCounter(); shared.Add(5);", file);
+    fclose(file);
+
+    SqratZygote zygote(&InitZygote);
+    zygote.AddBootstrapFile(_SC("zygote_bootstrap.nut"));
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.Start());
+    EXPECT_GT(zygote.GetPid(), 0);
+
+    // children see the state left by the bootstrap, but not what other children did
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.DoString(_SC("if (shared.Add(1) != 6) throw \"bad state\";")));
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.DoString(_SC("if (shared.Add(1) != 6) throw \"bad state\";")));
+
+    EXPECT_EQ(SqratVM::SQRAT_COMPILE_ERROR, zygote.DoString(_SC("local = ;")));
+    EXPECT_EQ(SqratVM::SQRAT_RUNTIME_ERROR, zygote.DoString(_SC("throw \"failed\";")));
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.DoFile(_SC("zygote_bootstrap.nut")));
+
+    // several children can run at the same time
+    int first = zygote.SpawnString(_SC("shared.Add(1);"));
+    int second = zygote.SpawnString(_SC("throw \"failed\";"));
+    EXPECT_GT(first, 0);
+    EXPECT_GT(second, 0);
+    EXPECT_EQ(SqratVM::SQRAT_RUNTIME_ERROR, zygote.Wait(second));
+    EXPECT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.Wait(first));
+
+    zygote.Stop();
+    EXPECT_EQ(-1, zygote.GetPid());
+    EXPECT_EQ(-1, zygote.DoString(_SC("shared.Add(1);")));
+    remove(bootstrap);
+}
+
+TEST_F(SqratTest, ZygoteBootstrapFailure)
+{
+    SqratZygote zygote(&InitZygote);
+    zygote.AddBootstrapFile(_SC("zygote_missing.nut"));
+    EXPECT_EQ(SqratVM::SQRAT_COMPILE_ERROR, zygote.Start());
+    EXPECT_EQ(-1, zygote.GetPid());
+}
+
+TEST_F(SqratTest, ZygoteDeadProcess)
+{
+    SqratZygote zygote(&InitZygote);
+    ASSERT_EQ(SqratVM::SQRAT_NO_ERROR, zygote.Start());
+    int pid = zygote.GetPid();
+    kill(pid, SIGKILL);
+    waitpid(pid, NULL, 0);
+
+    // writing to the dead zygote fails instead of raising SIGPIPE
+    EXPECT_EQ(-1, zygote.DoString(_SC("local x = 1;")));
+    zygote.Stop();
+    EXPECT_EQ(-1, zygote.GetPid());
+}
+
+#endif
@@ -28,7 +28,13 @@ TEST_CPPS="ClassBinding.cpp\
     NullPointerReturn.cpp\
     FuncInputArgumentType.cpp \
     ArrayBinding.cpp \
-    UniqueObject.cpp "
+    UniqueObject.cpp\
+    ClassDataCache.cpp\
+    ErrorState.cpp\
+    InlineAllocator.cpp\
+    PoolAllocator.cpp\
+    SharedPtr.cpp\
+    BindingReplay.cpp "
 
 for f in $TEST_CPPS; do
     gcc $CFLAGS \
@@ -203,11 +203,19 @@ static void sqrat_schedule(HSQUIRRELVM v, SQInteger idx) {
 static void sqrat_run(HSQUIRRELVM v) {
 
     HSQOBJECT taskArray;
+    HSQOBJECT threadKey; // Keys of the task slots, pushed once instead of interned again for every task
+    HSQOBJECT argsKey;
     HSQOBJECT thread;
     HSQUIRRELVM threadVm;
     SQInteger nparams;  // Number of parameters to pass to a function
     SQInteger arrayidx; //Cached index of the task array
 
+    // Push the keys below the task array so they stay referenced while the loop runs
+    sq->pushstring(v, _SC("thread"), -1);
+    sq->getstackobj(v, -1, &threadKey);
+    sq->pushstring(v, _SC("args"), -1);
+    sq->getstackobj(v, -1, &argsKey);
+
     // Push the tasklist
     sqrat_pushtaskarray(v); // Push the task array to the stack
 
@@ -233,7 +241,7 @@ static void sqrat_run(HSQUIRRELVM v) {
                 }
 
                 // Now that we have the task, get the thread
-                sq->pushstring(v, _SC("thread"), -1);
+                sq->pushobject(v, threadKey);
                 if(SQ_FAILED(sq->get(v, -2))) {
                     sq->arrayremove(v, -3, i);
                     sq->pop(v, 1);
@@ -251,7 +259,7 @@ static void sqrat_run(HSQUIRRELVM v) {
                     // Function to be called is already pushed to the thread (happens in schedule)
                     sq->pushroottable(threadVm); // Pus the threads root table
 
-                    sq->pushstring(v, _SC("args"), -1);
+                    sq->pushobject(v, argsKey);
                     if(SQ_FAILED(sq->get(v, -2))) { // Check to see if we have arguments for this thread
                         nparams = 0; // No arguments
                     } else {